@@ -1,13 +1,17 @@
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdlib>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
@@ -51,13 +55,22 @@ namespace
         return result;
     }
 
+    std::vector<std::string> splitFields(const std::string& line)
+    {
+        std::vector<std::string> tokens;
+        std::stringstream ss(line);
+        std::string token;
+        while (std::getline(ss, token, ';'))
+        {
+            tokens.push_back(trim(token));
+        }
+        return tokens;
+    }
+
     void clearScreen()
     {
-#ifdef _WIN32
-        std::system("cls");
-#else
-        std::system("clear");
-#endif
+        // Xoá màn hình bằng mã ANSI thay vì gọi system("clear") để không phải fork shell mỗi lần vẽ lại menu.
+        std::cout << "\x1b[2J\x1b[H" << std::flush;
     }
 
     void waitForEnter()
@@ -237,101 +250,261 @@ struct TopScorer
     int goals = 0;
 };
 
-class League
+// Chỉ mục thứ hạng theo điểm: mỗi mức điểm là một "ô" chứa các đội đã sắp theo Team::operator<,
+// cây Fenwick đếm số đội trong các ô để trả lời top-k, bottom-k, lọc theo điểm và thứ hạng trong O(log).
+class PointsIndex
 {
 public:
-    void addTeam(const Team& team)
+    void rebuild(const std::vector<Team>& teams)
     {
-        if (Team* existing = findTeam(team.getName()))
+        buckets.clear();
+        tree.clear();
+        total = 0;
+        if (teams.empty())
         {
-            *existing = team;
+            return;
         }
-        else
+
+        const auto bounds = std::minmax_element(teams.begin(), teams.end(), [](const Team& a, const Team& b) {
+            return a.getPoints() < b.getPoints();
+        });
+        minPoints = bounds.first->getPoints();
+        maxPoints = bounds.second->getPoints() + POINTS_HEADROOM;
+        buckets.assign(static_cast<std::size_t>(maxPoints - minPoints + 1), {});
+
+        for (std::size_t i = 0; i < teams.size(); ++i)
         {
-            teams.push_back(team);
+            buckets[slotFor(teams[i].getPoints())].push_back(i);
+        }
+        total = teams.size();
+        for (auto& bucket : buckets)
+        {
+            std::sort(bucket.begin(), bucket.end(), [&](std::size_t a, std::size_t b) { return teams[a] < teams[b]; });
         }
+        rebuildTree();
     }
 
-    bool loadTeamsFromFile(const std::string& path)
+    // Thêm đội teamIndex với chỉ số hiện tại của nó.
+    void insert(std::size_t teamIndex, const std::vector<Team>& teams)
     {
-        std::ifstream input(path);
-        if (!input)
+        const int points = teams[teamIndex].getPoints();
+        if (buckets.empty() || points < minPoints || points > maxPoints)
         {
-            return false;
+            growTo(points);
         }
 
-        std::vector<Team> loadedTeams;
-        std::string line;
-        while (std::getline(input, line))
+        auto& bucket = buckets[slotFor(points)];
+        const auto pos = std::lower_bound(bucket.begin(), bucket.end(), teamIndex, [&](std::size_t a, std::size_t b) {
+            return teams[a] < teams[b];
+        });
+        bucket.insert(pos, teamIndex);
+        add(slotFor(points), 1);
+        total += 1;
+    }
+
+    // Gỡ đội teamIndex; phải gọi trước khi chỉ số của đội thay đổi.
+    void erase(std::size_t teamIndex, const std::vector<Team>& teams)
+    {
+        const std::size_t slot = slotFor(teams[teamIndex].getPoints());
+        auto& bucket = buckets[slot];
+        auto pos = std::lower_bound(bucket.begin(), bucket.end(), teamIndex, [&](std::size_t a, std::size_t b) {
+            return teams[a] < teams[b];
+        });
+        while (pos != bucket.end() && *pos != teamIndex)
         {
-            line = trim(line);
-            if (line.empty() || line.front() == '#')
-            {
-                continue;
-            }
+            ++pos;
+        }
+        if (pos == bucket.end())
+        {
+            return;
+        }
+        bucket.erase(pos);
+        add(slot, -1);
+        total -= 1;
+    }
 
-            std::vector<std::string> tokens;
-            std::stringstream ss(line);
-            std::string token;
-            while (std::getline(ss, token, ';'))
-            {
-                tokens.push_back(trim(token));
-            }
+    std::size_t size() const { return total; }
 
-            if (tokens.empty())
-            {
-                continue;
-            }
+    // Số đội có điểm > points.
+    std::size_t countAbove(int points) const
+    {
+        if (buckets.empty() || points >= maxPoints)
+        {
+            return 0;
+        }
+        if (points < minPoints)
+        {
+            return total;
+        }
+        return prefix(slotFor(points));
+    }
 
-            if (tokens.size() == 1)
-            {
-                const std::string& maybeCount = tokens.front();
-                const bool numericLine = !maybeCount.empty()
-                                         && std::all_of(maybeCount.begin(),
-                                                        maybeCount.end(),
-                                                        [](unsigned char ch) {
-                                                            return std::isdigit(static_cast<unsigned char>(ch));
-                                                        });
-                if (numericLine)
-                {
-                    continue;
-                }
-            }
+    // Số đội có điểm >= points.
+    std::size_t countAtLeast(int points) const
+    {
+        return countAbove(points - 1);
+    }
 
-            Team team(tokens.front());
-            if (tokens.size() >= 6)
+    // Vị trí (tính từ 0) của đội teamIndex trên bảng xếp hạng.
+    std::size_t rankOf(std::size_t teamIndex, const std::vector<Team>& teams) const
+    {
+        const int points = teams[teamIndex].getPoints();
+        const auto& bucket = buckets[slotFor(points)];
+        const auto pos = std::lower_bound(bucket.begin(), bucket.end(), teamIndex, [&](std::size_t a, std::size_t b) {
+            return teams[a] < teams[b];
+        });
+        return countAbove(points) + static_cast<std::size_t>(pos - bucket.begin());
+    }
+
+    // Chỉ số các đội ở các vị trí [first, last) theo thứ tự bảng xếp hạng.
+    std::vector<std::size_t> range(std::size_t first, std::size_t last) const
+    {
+        std::vector<std::size_t> result;
+        last = std::min(last, total);
+        if (first >= last)
+        {
+            return result;
+        }
+        result.reserve(last - first);
+
+        std::size_t position = first;
+        while (position < last)
+        {
+            const auto located = locate(position);
+            const auto& bucket = buckets[located.first];
+            const std::size_t take = std::min(bucket.size() - located.second, last - position);
+            result.insert(result.end(),
+                          bucket.begin() + static_cast<std::ptrdiff_t>(located.second),
+                          bucket.begin() + static_cast<std::ptrdiff_t>(located.second + take));
+            position += take;
+        }
+        return result;
+    }
+
+private:
+    // Chừa sẵn khoảng điểm phía trên để cập nhật trận đấu ít khi phải mở rộng chỉ mục.
+    static constexpr int POINTS_HEADROOM = 64;
+
+    // Ô 0 ứng với điểm cao nhất, nên thứ tự ô chính là thứ tự bảng xếp hạng.
+    std::size_t slotFor(int points) const { return static_cast<std::size_t>(maxPoints - points); }
+
+    void growTo(int points)
+    {
+        if (buckets.empty())
+        {
+            minPoints = points;
+            maxPoints = points + POINTS_HEADROOM;
+            buckets.assign(static_cast<std::size_t>(POINTS_HEADROOM + 1), {});
+            rebuildTree();
+            return;
+        }
+
+        const int newMin = std::min(minPoints, points);
+        const int newMax = std::max(maxPoints, points + POINTS_HEADROOM);
+        std::vector<std::vector<std::size_t>> grown(static_cast<std::size_t>(newMax - newMin + 1));
+        for (std::size_t slot = 0; slot < buckets.size(); ++slot)
+        {
+            const int bucketPoints = maxPoints - static_cast<int>(slot);
+            grown[static_cast<std::size_t>(newMax - bucketPoints)] = std::move(buckets[slot]);
+        }
+        buckets = std::move(grown);
+        minPoints = newMin;
+        maxPoints = newMax;
+        rebuildTree();
+    }
+
+    void rebuildTree()
+    {
+        tree.assign(buckets.size() + 1, 0);
+        for (std::size_t slot = 0; slot < buckets.size(); ++slot)
+        {
+            const std::size_t node = slot + 1;
+            tree[node] += buckets[slot].size();
+            const std::size_t parent = node + (node & (~node + 1));
+            if (parent < tree.size())
             {
-                try
-                {
-                    const int wins = std::stoi(tokens[1]);
-                    const int draws = std::stoi(tokens[2]);
-                    const int losses = std::stoi(tokens[3]);
-                    const int goalsFor = std::stoi(tokens[4]);
-                    const int goalsAgainst = std::stoi(tokens[5]);
-                    const int points = (tokens.size() >= 7) ? std::stoi(tokens[6]) : (wins * 3 + draws);
-                    const int played = wins + draws + losses;
-                    team.setStats(played, wins, draws, losses, goalsFor, goalsAgainst, points);
-                }
-                catch (...)
-                {
-                    // Ignore malformed line.
-                    continue;
-                }
+                tree[parent] += tree[node];
             }
-            loadedTeams.push_back(team);
+        }
+    }
+
+    void add(std::size_t slot, int delta)
+    {
+        for (std::size_t node = slot + 1; node < tree.size(); node += node & (~node + 1))
+        {
+            tree[node] = static_cast<std::size_t>(static_cast<long long>(tree[node]) + delta);
+        }
+    }
 
-            if (loadedTeams.size() >= 20)
+    // Tổng số đội trong các ô [0, slot).
+    std::size_t prefix(std::size_t slot) const
+    {
+        std::size_t sum = 0;
+        for (std::size_t node = slot; node > 0; node -= node & (~node + 1))
+        {
+            sum += tree[node];
+        }
+        return sum;
+    }
+
+    // Tìm ô chứa vị trí position và độ lệch bên trong ô đó (nhảy nhị phân trên cây Fenwick).
+    std::pair<std::size_t, std::size_t> locate(std::size_t position) const
+    {
+        std::size_t node = 0;
+        std::size_t step = 1;
+        while (step * 2 < tree.size())
+        {
+            step *= 2;
+        }
+        for (; step > 0; step /= 2)
+        {
+            if (node + step < tree.size() && tree[node + step] <= position)
             {
-                break;
+                node += step;
+                position -= tree[node];
             }
         }
+        return {node, position};
+    }
 
-        if (loadedTeams.empty())
+    std::vector<std::vector<std::size_t>> buckets;
+    std::vector<std::size_t> tree;
+    std::size_t total = 0;
+    int minPoints = 0;
+    int maxPoints = 0;
+};
+
+class League
+{
+public:
+    void addTeam(const Team& team)
+    {
+        const std::size_t existing = findTeamIndex(team.getName());
+        if (existing != NOT_FOUND)
+        {
+            pointsIndex.erase(existing, teams);
+            teams[existing] = team;
+            pointsIndex.insert(existing, teams);
+        }
+        else
+        {
+            teams.push_back(team);
+            nameIndex[toLower(team.getName())] = teams.size() - 1;
+            pointsIndex.insert(teams.size() - 1, teams);
+        }
+    }
+
+    bool loadTeamsFromFile(const std::string& path)
+    {
+        awaitPendingLoads();
+
+        std::vector<Team> loadedTeams;
+        if (!parseTeamsFile(path, loadedTeams))
         {
             return false;
         }
 
-        teams = std::move(loadedTeams);
+        setTeams(std::move(loadedTeams));
         return true;
     }
 
@@ -348,16 +521,20 @@ public:
 
     bool updateMatch(const std::string& homeName, const std::string& awayName, int homeGoals, int awayGoals)
     {
-        Team* homeTeam = findTeam(homeName);
-        Team* awayTeam = findTeam(awayName);
+        const std::size_t home = findTeamIndex(homeName);
+        const std::size_t away = findTeamIndex(awayName);
 
-        if (!homeTeam || !awayTeam)
+        if (home == NOT_FOUND || away == NOT_FOUND || home == away)
         {
             return false;
         }
 
-        homeTeam->updateMatch(homeGoals, awayGoals);
-        awayTeam->updateMatch(awayGoals, homeGoals);
+        pointsIndex.erase(home, teams);
+        pointsIndex.erase(away, teams);
+        teams[home].updateMatch(homeGoals, awayGoals);
+        teams[away].updateMatch(awayGoals, homeGoals);
+        pointsIndex.insert(home, teams);
+        pointsIndex.insert(away, teams);
         return true;
     }
 
@@ -391,63 +568,14 @@ public:
 
     bool loadTopScorersFromFile(const std::string& path)
     {
-        std::ifstream input(path);
-        if (!input)
-        {
-            return false;
-        }
+        awaitPendingLoads();
 
         std::vector<TopScorer> loaded;
-        std::string line;
-        while (std::getline(input, line))
-        {
-            line = trim(line);
-            if (line.empty() || line.front() == '#')
-            {
-                continue;
-            }
-
-            std::vector<std::string> tokens;
-            std::stringstream ss(line);
-            std::string token;
-            while (std::getline(ss, token, ';'))
-            {
-                tokens.push_back(trim(token));
-            }
-
-            if (tokens.size() < 3)
-            {
-                continue;
-            }
-
-            try
-            {
-                const int goals = std::stoi(tokens[2]);
-                loaded.push_back({tokens[0], tokens[1], goals});
-            }
-            catch (...)
-            {
-                continue;
-            }
-        }
-
-        if (loaded.empty())
+        if (!parseTopScorersFile(path, loaded))
         {
             return false;
         }
 
-        std::sort(loaded.begin(), loaded.end(), [](const TopScorer& a, const TopScorer& b) {
-            if (a.goals != b.goals)
-            {
-                return a.goals > b.goals;
-            }
-            if (toLower(a.playerName) != toLower(b.playerName))
-            {
-                return toLower(a.playerName) < toLower(b.playerName);
-            }
-            return toLower(a.teamName) < toLower(b.teamName);
-        });
-
         topScorers = std::move(loaded);
         return true;
     }
@@ -491,14 +619,27 @@ public:
             return;
         }
 
-        const auto sorted = getSortedTable();
-        const std::vector<int> widths = {4, 20, 4, 4, 4, 4, 5, 5, 5, 5};
+        const bool colorize = useColor && (&os == &std::cout);
+        for (const std::string& line : tableLines(colorize))
+        {
+            os << line << '\n';
+        }
+    }
 
-        const std::string topLine = buildSeparator("┌", "┬", "┐", widths);
-        const std::string midLine = buildSeparator("├", "┼", "┤", widths);
-        const std::string bottomLine = buildSeparator("└", "┴", "┘", widths);
+    // Từng dòng của bảng (viền, tiêu đề, các đội) đã định dạng sẵn, dùng chung cho printTable và chế độ live.
+    std::vector<std::string> tableLines(bool colorize) const
+    {
+        std::vector<std::string> lines;
+        if (teams.empty())
+        {
+            return lines;
+        }
 
-        os << topLine << '\n';
+        const auto sorted = pointsIndex.range(0, pointsIndex.size());
+        const std::vector<int> widths = {4, 20, 4, 4, 4, 4, 5, 5, 5, 5};
+        lines.reserve(sorted.size() + 4);
+
+        lines.push_back(buildSeparator("┌", "┬", "┐", widths));
         {
             std::ostringstream header;
             header << "│" << std::setw(widths[0]) << std::right << "Pos";
@@ -513,16 +654,17 @@ public:
             header << "│" << std::setw(widths[8]) << std::right << "GD";
             header << "│" << std::setw(widths[9]) << std::right << "Pts";
             header << "│";
-            os << header.str() << '\n';
+            lines.push_back(header.str());
         }
-        os << midLine << '\n';
+        lines.push_back(buildSeparator("├", "┼", "┤", widths));
 
-        const bool colorize = useColor && (&os == &std::cout);
         for (std::size_t i = 0; i < sorted.size(); ++i)
         {
-            const Team& team = sorted[i];
+            const Team& team = teams[sorted[i]];
+            const std::string color = colorize ? colorForPosition(i, sorted.size()) : std::string();
             std::ostringstream row;
 
+            row << color;
             row << "│" << std::setw(widths[0]) << std::right << (i + 1);
             row << "│" << std::setw(widths[1]) << std::left << team.getName();
             row << std::right;
@@ -534,28 +676,16 @@ public:
             row << "│" << std::setw(widths[7]) << std::right << team.getGoalsAgainst();
             row << "│" << std::setw(widths[8]) << std::right << team.goalDifference();
             row << "│" << std::setw(widths[9]) << std::right << team.getPoints() << "│";
-
-            if (colorize)
-            {
-                const std::string color = colorForPosition(i, sorted.size());
-                if (!color.empty())
-                {
-                    os << color;
-                }
-                os << row.str();
-                if (!color.empty())
-                {
-                    os << COLOR_RESET;
-                }
-                os << '\n';
-            }
-            else
+            if (!color.empty())
             {
-                os << row.str() << '\n';
+                row << COLOR_RESET;
             }
+
+            lines.push_back(row.str());
         }
 
-        os << bottomLine << '\n';
+        lines.push_back(buildSeparator("└", "┴", "┘", widths));
+        return lines;
     }
 
     void printAggregateStats(std::ostream& os) const
@@ -606,18 +736,13 @@ public:
 
     void filterByPoints(std::ostream& os, int threshold) const
     {
-        const auto sorted = getSortedTable();
         os << "Các đội có điểm > " << threshold << ":\n";
-        bool found = false;
-        for (const Team& team : sorted)
+        const auto matches = pointsIndex.range(0, pointsIndex.countAbove(threshold));
+        for (std::size_t index : matches)
         {
-            if (team.getPoints() > threshold)
-            {
-                os << "- " << team << '\n';
-                found = true;
-            }
+            os << "- " << teams[index] << '\n';
         }
-        if (!found)
+        if (matches.empty())
         {
             os << "Không có đội nào đạt yêu cầu.\n";
         }
@@ -625,67 +750,274 @@ public:
 
     void showTopTeams(std::ostream& os, int count) const
     {
-        const auto sorted = getSortedTable();
         os << "Top " << count << " đội dẫn đầu:\n";
-        for (int i = 0; i < count && i < static_cast<int>(sorted.size()); ++i)
-        {
-            os << (i + 1) << ". " << sorted[i] << '\n';
-        }
+        printPositions(os, 0, static_cast<std::size_t>(std::max(count, 0)));
     }
 
     void showRelegationZone(std::ostream& os, int count) const
     {
-        const auto sorted = getSortedTable();
-        if (sorted.empty())
+        if (teams.empty())
         {
             os << "Chưa có dữ liệu.\n";
             return;
         }
         os << "Nhóm xuống hạng (" << count << " đội cuối bảng):\n";
-        const int total = static_cast<int>(sorted.size());
-        for (int i = total - count; i < total; ++i)
+        const std::size_t total = pointsIndex.size();
+        const std::size_t wanted = std::min(static_cast<std::size_t>(std::max(count, 0)), total);
+        printPositions(os, total - wanted, total);
+    }
+
+    void showTeamRank(std::ostream& os, const std::string& name) const
+    {
+        const std::size_t index = findTeamIndex(name);
+        if (index == NOT_FOUND)
         {
-            if (i >= 0)
-            {
-                os << (i + 1) << ". " << sorted[static_cast<std::size_t>(i)] << '\n';
-            }
+            os << "Không tìm thấy đội \"" << name << "\".\n";
+            return;
+        }
+        const std::size_t position = pointsIndex.rankOf(index, teams);
+        os << teams[index].getName() << " đang xếp thứ " << (position + 1) << "/" << pointsIndex.size() << ":\n";
+        os << (position + 1) << ". " << teams[index] << '\n';
+    }
+
+    // Các đội có điểm chênh không quá margin so với đội ở vị trí position (tính từ 1).
+    void showTeamsNearPosition(std::ostream& os, int position, int margin) const
+    {
+        if (position < 1 || static_cast<std::size_t>(position) > pointsIndex.size())
+        {
+            os << "Vị trí không hợp lệ.\n";
+            return;
         }
+        const auto anchor = pointsIndex.range(static_cast<std::size_t>(position - 1), static_cast<std::size_t>(position));
+        const int points = teams[anchor.front()].getPoints();
+        os << "Các đội cách vị trí " << position << " (" << points << " điểm) không quá " << margin << " điểm:\n";
+        printPositions(os, pointsIndex.countAbove(points + margin), pointsIndex.countAtLeast(points - margin));
     }
 
+    // Bắt đầu đọc file đội bóng và vua phá lưới song song trên luồng nền; menu dùng được ngay.
+    void preloadFromFiles(const std::string& teamsPath, const std::string& scorersPath)
+    {
+        awaitPendingLoads();
+
+        pendingTeams = std::async(std::launch::async, [teamsPath] {
+            std::vector<Team> loaded;
+            parseTeamsFile(teamsPath, loaded);
+            return loaded;
+        });
+        pendingScorers = std::async(std::launch::async, [scorersPath] {
+            std::vector<TopScorer> loaded;
+            parseTopScorersFile(scorersPath, loaded);
+            return loaded;
+        });
+    }
+
+    // Đưa vào League những kết quả nạp nền đã xong mà không phải chờ.
+    void publishReadyLoads()
+    {
+        if (isReady(pendingTeams))
+        {
+            publishTeams();
+        }
+        if (isReady(pendingScorers))
+        {
+            publishScorers();
+        }
+    }
+
+    // Chờ mọi lần nạp nền còn dang dở; gọi trước mọi truy vấn cần dữ liệu.
+    void awaitPendingLoads()
+    {
+        if (pendingTeams.valid())
+        {
+            publishTeams();
+        }
+        if (pendingScorers.valid())
+        {
+            publishScorers();
+        }
+    }
+
+    bool isLoading() const { return pendingTeams.valid() || pendingScorers.valid(); }
+
     bool empty() const { return teams.empty(); }
+    std::size_t size() const { return teams.size(); }
 
 private:
-    Team* findTeam(const std::string& name)
+    static bool parseTeamsFile(const std::string& path, std::vector<Team>& loadedTeams)
     {
-        const std::string target = toLower(name);
-        for (Team& team : teams)
+        std::ifstream input(path);
+        if (!input)
         {
-            if (toLower(team.getName()) == target)
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(input, line))
+        {
+            line = trim(line);
+            if (line.empty() || line.front() == '#')
+            {
+                continue;
+            }
+
+            const std::vector<std::string> tokens = splitFields(line);
+
+            if (tokens.empty())
             {
-                return &team;
+                continue;
+            }
+
+            if (tokens.size() == 1)
+            {
+                const std::string& maybeCount = tokens.front();
+                const bool numericLine = !maybeCount.empty()
+                                         && std::all_of(maybeCount.begin(),
+                                                        maybeCount.end(),
+                                                        [](unsigned char ch) {
+                                                            return std::isdigit(static_cast<unsigned char>(ch));
+                                                        });
+                if (numericLine)
+                {
+                    continue;
+                }
             }
+
+            Team team(tokens.front());
+            if (tokens.size() >= 6)
+            {
+                try
+                {
+                    const int wins = std::stoi(tokens[1]);
+                    const int draws = std::stoi(tokens[2]);
+                    const int losses = std::stoi(tokens[3]);
+                    const int goalsFor = std::stoi(tokens[4]);
+                    const int goalsAgainst = std::stoi(tokens[5]);
+                    const int points = (tokens.size() >= 7) ? std::stoi(tokens[6]) : (wins * 3 + draws);
+                    const int played = wins + draws + losses;
+                    team.setStats(played, wins, draws, losses, goalsFor, goalsAgainst, points);
+                }
+                catch (...)
+                {
+                    // Ignore malformed line.
+                    continue;
+                }
+            }
+            loadedTeams.push_back(team);
+        }
+
+        if (loadedTeams.empty())
+        {
+            return false;
         }
-        return nullptr;
+
+        return true;
     }
 
-    const Team* findTeam(const std::string& name) const
+    static bool parseTopScorersFile(const std::string& path, std::vector<TopScorer>& loaded)
     {
-        const std::string target = toLower(name);
-        for (const Team& team : teams)
+        std::ifstream input(path);
+        if (!input)
         {
-            if (toLower(team.getName()) == target)
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(input, line))
+        {
+            line = trim(line);
+            if (line.empty() || line.front() == '#')
+            {
+                continue;
+            }
+
+            const std::vector<std::string> tokens = splitFields(line);
+
+            if (tokens.size() < 3)
+            {
+                continue;
+            }
+
+            try
+            {
+                const int goals = std::stoi(tokens[2]);
+                loaded.push_back({tokens[0], tokens[1], goals});
+            }
+            catch (...)
+            {
+                continue;
+            }
+        }
+
+        if (loaded.empty())
+        {
+            return false;
+        }
+
+        std::sort(loaded.begin(), loaded.end(), [](const TopScorer& a, const TopScorer& b) {
+            if (a.goals != b.goals)
+            {
+                return a.goals > b.goals;
+            }
+            if (toLower(a.playerName) != toLower(b.playerName))
             {
-                return &team;
+                return toLower(a.playerName) < toLower(b.playerName);
             }
+            return toLower(a.teamName) < toLower(b.teamName);
+        });
+
+        return true;
+    }
+
+    template <typename T>
+    static bool isReady(const std::future<T>& pending)
+    {
+        return pending.valid()
+               && pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    void publishTeams()
+    {
+        std::vector<Team> loaded = pendingTeams.get();
+        if (!loaded.empty())
+        {
+            setTeams(std::move(loaded));
+        }
+    }
+
+    void setTeams(std::vector<Team> loaded)
+    {
+        teams = std::move(loaded);
+        nameIndex.clear();
+        nameIndex.reserve(teams.size());
+        for (std::size_t i = 0; i < teams.size(); ++i)
+        {
+            nameIndex[toLower(teams[i].getName())] = i;
         }
-        return nullptr;
+        pointsIndex.rebuild(teams);
     }
 
-    std::vector<Team> getSortedTable() const
+    void printPositions(std::ostream& os, std::size_t first, std::size_t last) const
     {
-        std::vector<Team> sorted = teams;
-        std::sort(sorted.begin(), sorted.end());
-        return sorted;
+        std::size_t position = first;
+        for (std::size_t index : pointsIndex.range(first, last))
+        {
+            os << ++position << ". " << teams[index] << '\n';
+        }
+    }
+
+    void publishScorers()
+    {
+        std::vector<TopScorer> loaded = pendingScorers.get();
+        if (!loaded.empty())
+        {
+            topScorers = std::move(loaded);
+        }
+    }
+
+    std::size_t findTeamIndex(const std::string& name) const
+    {
+        const auto it = nameIndex.find(toLower(name));
+        return it == nameIndex.end() ? NOT_FOUND : it->second;
     }
 
     std::string colorForPosition(std::size_t index, std::size_t total) const
@@ -705,19 +1037,177 @@ private:
         return {};
     }
 
+    static constexpr std::size_t NOT_FOUND = std::numeric_limits<std::size_t>::max();
+
     std::vector<Team> teams;
+    std::unordered_map<std::string, std::size_t> nameIndex;
+    PointsIndex pointsIndex;
     std::vector<TopScorer> topScorers;
+    std::future<std::vector<Team>> pendingTeams;
+    std::future<std::vector<TopScorer>> pendingScorers;
 };
 
+// Chế độ bảng xếp hạng trực tiếp: giữ bảng trên màn hình và chỉ vẽ lại những dòng thay đổi.
+class LiveDashboard
+{
+public:
+    explicit LiveDashboard(const League& league, int maxFramesPerSecond = 20)
+        : league(league),
+          frameInterval(std::chrono::milliseconds(1000 / std::max(maxFramesPerSecond, 1)))
+    {
+    }
+
+    void open()
+    {
+        shownLines.clear();
+        dirty = true;
+        present(true);
+    }
+
+    void setStatus(const std::string& text)
+    {
+        status = text;
+        dirty = true;
+    }
+
+    void markDirty() { dirty = true; }
+
+    // Vẽ một khung hình nếu có thay đổi; không vượt quá tần số khung hình trừ khi force.
+    void present(bool force)
+    {
+        if (!dirty)
+        {
+            return;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!force && now - lastFrame < frameInterval)
+        {
+            return;
+        }
+
+        std::vector<std::string> lines;
+        lines.push_back("===== BẢNG XẾP HẠNG TRỰC TIẾP =====");
+        lines.push_back("Nhập kết quả dạng: Đội nhà;Đội khách;Bàn nhà;Bàn khách (Enter trống để thoát)");
+        for (std::string& line : league.tableLines(true))
+        {
+            lines.push_back(std::move(line));
+        }
+        lines.push_back(status);
+
+        frame.clear();
+        if (lines.size() != shownLines.size())
+        {
+            // Số dòng thay đổi (lần đầu hoặc số đội khác) nên vẽ lại toàn bộ.
+            frame += "\x1b[2J";
+            shownLines.assign(lines.size(), std::string());
+        }
+
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            if (lines[i] == shownLines[i])
+            {
+                continue;
+            }
+            moveCursor(i + 1);
+            frame += lines[i];
+            frame += "\x1b[K";
+            shownLines[i] = std::move(lines[i]);
+        }
+
+        // Đưa con trỏ về dòng nhập liệu ngay dưới bảng và xoá phần còn lại của màn hình.
+        moveCursor(shownLines.size() + 1);
+        frame += "\x1b[J> ";
+
+        std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+        std::cout.flush();
+
+        lastFrame = now;
+        dirty = false;
+    }
+
+private:
+    void moveCursor(std::size_t row)
+    {
+        frame += "\x1b[";
+        frame += std::to_string(row);
+        frame += ";1H";
+    }
+
+    const League& league;
+    std::chrono::steady_clock::duration frameInterval;
+    std::chrono::steady_clock::time_point lastFrame{};
+    std::vector<std::string> shownLines;
+    std::string status;
+    std::string frame;
+    bool dirty = true;
+};
+
+void runLiveDashboard(League& league)
+{
+    LiveDashboard dashboard(league);
+    dashboard.open();
+
+    int applied = 0;
+    std::string line;
+    while (std::getline(std::cin, line))
+    {
+        line = trim(line);
+        if (line.empty())
+        {
+            break;
+        }
+
+        const std::vector<std::string> tokens = splitFields(line);
+        bool ok = false;
+        if (tokens.size() == 4)
+        {
+            try
+            {
+                const int homeGoals = std::stoi(tokens[2]);
+                const int awayGoals = std::stoi(tokens[3]);
+                ok = homeGoals >= 0 && awayGoals >= 0
+                     && league.updateMatch(tokens[0], tokens[1], homeGoals, awayGoals);
+            }
+            catch (...)
+            {
+                ok = false;
+            }
+        }
+
+        if (ok)
+        {
+            applied += 1;
+            dashboard.setStatus("Đã cập nhật " + std::to_string(applied) + " trận. Mới nhất: " + line);
+        }
+        else
+        {
+            dashboard.setStatus("Bỏ qua dòng không hợp lệ: " + line);
+        }
+
+        // Với loạt kết quả dồn dập, các khung hình trong cùng một khoảng frameInterval được gộp lại.
+        dashboard.present(false);
+    }
+
+    dashboard.present(true);
+    std::cout << '\n';
+}
+
 int main()
 {
     League league;
+    league.preloadFromFiles("teams.txt", "player.txt");
     bool running = true;
 
     while (running)
     {
         clearScreen();
+        league.publishReadyLoads();
         std::cout << "===== QUẢN LÝ BẢNG XẾP HẠNG EPL =====\n";
+        if (league.isLoading())
+        {
+            std::cout << "(Đang nạp teams.txt và player.txt ở chế độ nền...)\n";
+        }
         std::cout << "1. Nạp danh sách đội từ file\n";
         std::cout << "2. Hiển thị bảng xếp hạng\n";
         std::cout << "3. Cập nhật kết quả trận đấu\n";
@@ -725,9 +1215,14 @@ int main()
         std::cout << "5. Truy vấn & lọc đội bóng\n";
         std::cout << "6. Xuất bảng xếp hạng ra ranking.txt\n";
         std::cout << "7. Quản lý vua phá lưới\n";
+        std::cout << "8. Bảng xếp hạng trực tiếp (live)\n";
         std::cout << "0. Thoát\n";
 
-        const int choice = readInt("Chọn chức năng: ", 0, 7);
+        const int choice = readInt("Chọn chức năng: ", 0, 8);
+        if (choice != 0)
+        {
+            league.awaitPendingLoads();
+        }
 
         switch (choice)
         {
@@ -805,7 +1300,9 @@ int main()
             std::cout << "1. Liệt kê đội có điểm > X\n";
             std::cout << "2. Xem top 4 đội\n";
             std::cout << "3. Xem nhóm xuống hạng\n";
-            const int filterChoice = readInt("Chọn: ", 1, 3);
+            std::cout << "4. Xem thứ hạng của một đội\n";
+            std::cout << "5. Các đội cách vị trí P không quá N điểm\n";
+            const int filterChoice = readInt("Chọn: ", 1, 5);
 
             if (filterChoice == 1)
             {
@@ -816,10 +1313,23 @@ int main()
             {
                 league.showTopTeams(std::cout, 4);
             }
-            else
+            else if (filterChoice == 3)
             {
                 league.showRelegationZone(std::cout, 3);
             }
+            else if (filterChoice == 4)
+            {
+                std::cout << "Tên đội: ";
+                std::string name;
+                std::getline(std::cin, name);
+                league.showTeamRank(std::cout, trim(name));
+            }
+            else
+            {
+                const int position = readInt("Nhập vị trí P: ", 1, static_cast<int>(league.size()));
+                const int margin = readPositiveInt("Nhập số điểm N: ");
+                league.showTeamsNearPosition(std::cout, position, margin);
+            }
             waitForEnter();
             break;
         }
@@ -876,6 +1386,18 @@ int main()
             waitForEnter();
             break;
         }
+        case 8:
+        {
+            if (league.empty())
+            {
+                std::cout << "Vui lòng nạp danh sách đội trước.\n";
+                waitForEnter();
+                break;
+            }
+
+            runLiveDashboard(league);
+            break;
+        }
         case 0:
         default:
             running = false;
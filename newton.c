@@ -0,0 +1,233 @@
+#include "newton.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+int dathuc_tao(DaThuc *p, int bac) {
+    p->bac = bac;
+    p->hs = bac >= 0 ? calloc((size_t)bac + 1, sizeof(double)) : NULL;
+    return p->hs ? 0 : -1;
+}
+
+void dathuc_giaiphong(DaThuc *p) {
+    free(p->hs);
+    p->hs = NULL;
+    p->bac = -1;
+}
+
+// Tính đồng thời f(x), f'(x), f''(x) bằng một lượt Horner, không dùng pow
+void dathuc_danhgia(const DaThuc *p, double x, double *fx, double *d1, double *d2) {
+    const double *hs = p->hs;
+    double f = hs[p->bac], df = 0, ddf = 0;
+    for (int i = p->bac - 1; i >= 0; i--) {
+        ddf = ddf * x + df; // ddf = f''/2 tích luỹ dần
+        df = df * x + f;
+        f = f * x + hs[i];
+    }
+    *fx = f;
+    if (d1) *d1 = df;
+    if (d2) *d2 = 2 * ddf;
+}
+
+// Bao khoảng giá trị của g trên [a,b] bằng Horner trên số học khoảng, làm tròn ra ngoài
+// mỗi bước để khoảng thu được chắc chắn chứa mọi g(x), x thuộc [a,b]
+static void horner_khoang(const double *hs, int bac, double a, double b, double *thap, double *cao) {
+    double lo = hs[bac], hi = hs[bac];
+    for (int i = bac - 1; i >= 0; i--) {
+        double t1 = lo * a, t2 = lo * b, t3 = hi * a, t4 = hi * b;
+        lo = nextafter(fmin(fmin(t1, t2), fmin(t3, t4)) + hs[i], -INFINITY);
+        hi = nextafter(fmax(fmax(t1, t2), fmax(t3, t4)) + hs[i], INFINITY);
+    }
+    *thap = lo;
+    *cao = hi;
+}
+
+// 1 nếu đa thức g (bậc bac) không có nghiệm trong (a,b), tức là giữ nguyên dấu trên khoảng
+static int khong_doidau(double *hs, int bac, double a, double b) {
+    while (bac > 0 && hs[bac] == 0) bac--;
+    if (bac <= 0) return 1; // Đa thức hằng không đổi dấu
+
+    // Đường nhanh: bao khoảng không chứa 0 thì đã chứng minh xong
+    double thap, cao;
+    horner_khoang(hs, bac, a, b, &thap, &cao);
+    if (thap > 0 || cao < 0) return 1;
+
+    // Đường chính xác: đếm nghiệm phân biệt trong (a,b] bằng dãy Sturm, bỏ nghiệm đúng tại b
+    DaThuc g = {bac, hs};
+    double gb;
+    dathuc_danhgia(&g, b, &gb, NULL, NULL);
+    int songhiem = dathuc_songhiem(&g, a, b) - (gb == 0);
+    return songhiem == 0;
+}
+
+// Hàm kiểm tra điều kiện hội tụ Furie: f' và f'' không đổi dấu trên [a,b].
+// Chứng minh bằng bao khoảng Horner hoặc số nghiệm Sturm của f', f'' nên chi phí
+// không phụ thuộc độ rộng khoảng và không bỏ sót lần đổi dấu nào giữa hai điểm mẫu.
+int furie(const DaThuc *p, double a, double b) {
+    if (p->bac == 1) return 1; // Bậc nhất luôn hội tụ, chọn a làm điểm bắt đầu
+
+    int n = p->bac;
+    double *daoham = malloc(sizeof(double) * (size_t)(2 * n - 1));
+    if (!daoham) return -2;
+    double *d1hs = daoham, *d2hs = daoham + n; // f' bậc n-1, f'' bậc n-2
+    for (int i = 1; i <= n; i++) d1hs[i - 1] = i * p->hs[i];
+    for (int i = 2; i <= n; i++) d2hs[i - 2] = (double)i * (i - 1) * p->hs[i];
+
+    int giudau = khong_doidau(d1hs, n - 1, a, b) && khong_doidau(d2hs, n - 2, a, b);
+    free(daoham);
+    if (!giudau) return -2; // f' hoặc f'' đổi dấu → không hội tụ
+
+    // Chọn hướng hội tụ theo dấu f * f''
+    double fa, d2a, fb, d2b;
+    dathuc_danhgia(p, a, &fa, NULL, &d2a);
+    if (fa * d2a > 0) return 1;
+    dathuc_danhgia(p, b, &fb, NULL, &d2b);
+    if (fb * d2b > 0) return -1;
+
+    return 0;
+}
+
+// Thuật toán Newton tìm nghiệm gần đúng
+KetQuaNewton newton(const DaThuc *p, double a, double b, double x0, const TuyChonNewton *tuychon) {
+    KetQuaNewton kq = {x0, 0, INFINITY, INFINITY, NEWTON_LOI_THAMSO};
+    if (!p || !p->hs || p->bac < 1 || !tuychon || tuychon->eps <= 0) return kq;
+
+    double fx, fdx;
+
+    // Xử lý riêng cho bậc nhất: chỉ lặp 1 lần
+    if (p->bac == 1) {
+        dathuc_danhgia(p, x0, &fx, &fdx, NULL);
+        if (fabs(fdx) < 1e-12) {
+            kq.trangthai = NEWTON_DAOHAM_0;
+            return kq;
+        }
+
+        double x1 = x0 - fx / fdx, fx1;
+        dathuc_danhgia(p, x1, &fx1, NULL, NULL);
+        kq.nghiem = x1;
+        kq.solap = 1;
+        kq.saiso = kq.phandu = fabs(fx1); // Sai số = |f(x1)|
+        kq.trangthai = NEWTON_HOITU;
+        if (tuychon->theodoi) tuychon->theodoi(tuychon->ngucanh, 1, x1, kq.saiso);
+        return kq;
+    }
+
+    double x = x0, saiso = 1e9; // Sai số khởi tạo lớn để bắt đầu vòng lặp
+    int lap = 0;
+    TrangThaiNewton trangthai = NEWTON_QUA_SOLAP;
+
+    while (saiso > tuychon->eps && lap < tuychon->maxlap) {
+        if (x < a || x > b) {
+            trangthai = NEWTON_RA_NGOAI;
+            break;
+        }
+
+        dathuc_danhgia(p, x, &fx, &fdx, NULL);
+        if (fabs(fdx) < 1e-12) { // Nếu đạo hàm gần 0, dừng để tránh chia 0
+            trangthai = NEWTON_DAOHAM_0;
+            break;
+        }
+
+        double x_sau = x - fx / fdx; // Công thức Newton-Raphson
+        saiso = fabs(x_sau - x); // Cập nhật sai số
+        x = x_sau; // Gán lại x cho vòng lặp sau
+        lap++;
+
+        if (tuychon->theodoi) tuychon->theodoi(tuychon->ngucanh, lap, x, saiso);
+    }
+
+    dathuc_danhgia(p, x, &fx, NULL, NULL);
+    kq.nghiem = x;
+    kq.solap = lap;
+    kq.saiso = saiso;
+    kq.phandu = fabs(fx);
+    kq.trangthai = saiso <= tuychon->eps ? NEWTON_HOITU : trangthai;
+    return kq;
+}
+
+KetQuaNewton newton_antoan(const DaThuc *p, double a, double b, const TuyChonNewton *tuychon) {
+    KetQuaNewton kq = {a, 0, INFINITY, INFINITY, NEWTON_LOI_THAMSO};
+    if (!p || !p->hs || p->bac < 1 || !tuychon || tuychon->eps <= 0 || !(a <= b)) return kq;
+
+    double fa, fb, fx, fdx;
+    dathuc_danhgia(p, a, &fa, NULL, NULL);
+    dathuc_danhgia(p, b, &fb, NULL, NULL);
+    if (fa == 0 || fb == 0) { // Nghiệm nằm đúng ở đầu mút
+        kq.nghiem = fa == 0 ? a : b;
+        kq.saiso = kq.phandu = 0;
+        kq.trangthai = NEWTON_HOITU;
+        return kq;
+    }
+    if ((fa > 0) == (fb > 0)) {
+        kq.trangthai = NEWTON_KHONG_KEP;
+        return kq;
+    }
+
+    // Đặt xam là đầu mút có f < 0, xduong là đầu mút có f > 0
+    double xam = fa < 0 ? a : b, xduong = fa < 0 ? b : a;
+    double fam = fa < 0 ? fa : fb, fduong = fa < 0 ? fb : fa;
+    double x = 0.5 * (a + b), buoc = fabs(b - a), buoctruoc = buoc;
+    // Cứ 3 bước mà khoảng kẹp chưa co được một nửa thì bước kế tiếp bắt buộc chia đôi,
+    // nhờ vậy khoảng kẹp co ít nhất một nửa sau mỗi 4 bước
+    double rongmoc = fabs(b - a);
+    int demmoc = 0, epchiadoi = 0;
+
+    kq.trangthai = NEWTON_QUA_SOLAP;
+    for (int lap = 1; lap <= tuychon->maxlap; lap++) {
+        dathuc_danhgia(p, x, &fx, &fdx, NULL);
+        if (fx == 0) {
+            kq.saiso = 0;
+            kq.trangthai = NEWTON_HOITU;
+            kq.solap = lap - 1;
+            break;
+        }
+        if (fx < 0) { xam = x; fam = fx; } else { xduong = x; fduong = fx; }
+
+        double x_sau;
+        int ngoai = ((x - xduong) * fdx - fx) * ((x - xam) * fdx - fx) > 0; // Bước Newton rơi ra ngoài khoảng kẹp
+        int cham = fabs(2 * fx) > fabs(buoctruoc * fdx);                   // Bước Newton không giảm đủ nhanh
+        buoctruoc = buoc;
+        double trai = fmin(xam, xduong), phai = fmax(xam, xduong);
+        if (epchiadoi) {
+            x_sau = 0.5 * (trai + phai);
+            epchiadoi = 0;
+        } else if (!ngoai && !cham && fdx != 0) {
+            x_sau = x - fx / fdx;
+        } else {
+            x_sau = xam - fam * (xduong - xam) / (fduong - fam); // Cát tuyến qua hai đầu khoảng kẹp
+            if (!(x_sau > trai && x_sau < phai)) x_sau = 0.5 * (trai + phai);
+        }
+        if (++demmoc == 3) {
+            epchiadoi = phai - trai > 0.5 * rongmoc;
+            rongmoc = phai - trai;
+            demmoc = 0;
+        }
+
+        buoc = fabs(x_sau - x);
+        x = x_sau;
+        kq.solap = lap;
+        if (tuychon->theodoi) tuychon->theodoi(tuychon->ngucanh, lap, x, buoc);
+        if (buoc <= tuychon->eps || fabs(xduong - xam) <= tuychon->eps) {
+            kq.trangthai = NEWTON_HOITU;
+            break;
+        }
+    }
+
+    dathuc_danhgia(p, x, &fx, NULL, NULL);
+    kq.nghiem = x;
+    kq.saiso = kq.trangthai == NEWTON_HOITU && fx == 0 ? 0 : buoc;
+    kq.phandu = fabs(fx);
+    return kq;
+}
+
+const char *newton_trangthai_ten(TrangThaiNewton trangthai) {
+    switch (trangthai) {
+        case NEWTON_HOITU: return "hoi tu";
+        case NEWTON_QUA_SOLAP: return "qua so lan lap";
+        case NEWTON_RA_NGOAI: return "ra ngoai khoang";
+        case NEWTON_DAOHAM_0: return "dao ham bang 0";
+        case NEWTON_LOI_THAMSO: return "tham so khong hop le";
+        case NEWTON_KHONG_KEP: return "f(a), f(b) cung dau";
+    }
+    return "?";
+}
@@ -0,0 +1,125 @@
+#ifndef NEWTON_H
+#define NEWTON_H
+
+#include <stdio.h>
+
+// Thư viện giải phương trình đa thức f(x) = 0 bằng phương pháp Newton (tiếp tuyến).
+// Mọi hàm chỉ làm việc trên dữ liệu được truyền vào, không dùng biến toàn cục
+// và không in ra màn hình, nên có thể gọi đồng thời từ nhiều luồng.
+
+// Đa thức bậc bac: f(x) = hs[bac]*x^bac + ... + hs[1]*x + hs[0]
+typedef struct {
+    int bac;
+    double *hs; // bac + 1 hệ số, hs[i] là hệ số của x^i
+} DaThuc;
+
+// Trạng thái kết thúc của một lần giải
+typedef enum {
+    NEWTON_HOITU = 0,   // Đạt sai số eps
+    NEWTON_QUA_SOLAP,   // Hết số lần lặp cho phép
+    NEWTON_RA_NGOAI,    // Điểm lặp ra khỏi khoảng [a,b]
+    NEWTON_DAOHAM_0,    // f'(x) ~ 0, không thể chia
+    NEWTON_LOI_THAMSO,  // Tham số không hợp lệ
+    NEWTON_KHONG_KEP    // f(a), f(b) cùng dấu nên [a,b] không kẹp được nghiệm
+} TrangThaiNewton;
+
+// Hàm theo dõi từng bước lặp (lap, x, saiso); dùng để người gọi tự in bảng lặp
+typedef void (*NewtonTheoDoi)(void *ngucanh, int lap, double x, double saiso);
+
+typedef struct {
+    double eps;            // Sai số cho phép
+    int maxlap;            // Số lần lặp tối đa
+    NewtonTheoDoi theodoi; // Có thể NULL
+    void *ngucanh;         // Con trỏ truyền nguyên vẹn cho theodoi
+} TuyChonNewton;
+
+typedef struct {
+    double nghiem;  // Nghiệm gần đúng
+    int solap;      // Số lần lặp đã thực hiện
+    double saiso;   // |x_k - x_(k-1)| ở bước cuối (bậc nhất: |f(x1)|)
+    double phandu;  // |f(nghiem)|
+    TrangThaiNewton trangthai;
+} KetQuaNewton;
+
+// Cấp phát đa thức bậc bac với toàn bộ hệ số = 0. Trả về 0 nếu thành công.
+int dathuc_tao(DaThuc *p, int bac);
+void dathuc_giaiphong(DaThuc *p);
+
+// Tính f(x), f'(x), f''(x) trong một lượt Horner; d1, d2 có thể NULL
+void dathuc_danhgia(const DaThuc *p, double x, double *fx, double *d1, double *d2);
+
+// Kiểm tra điều kiện hội tụ Furie trên [a,b] (f', f'' không có nghiệm trong (a,b)):
+//  1 → bắt đầu từ a, -1 → bắt đầu từ b, -2 → f' hoặc f'' đổi dấu, 0 → không chọn được điểm đầu
+int furie(const DaThuc *p, double a, double b);
+
+// Lặp Newton từ x0 trong khoảng [a,b]
+KetQuaNewton newton(const DaThuc *p, double a, double b, double x0, const TuyChonNewton *tuychon);
+
+// Newton có bảo vệ (kiểu rtsafe/Brent): luôn giữ khoảng [a,b] kẹp nghiệm (f(a)*f(b) <= 0),
+// bước Newton nào nhảy ra ngoài khoảng hoặc giảm chậm thì thay bằng bước cát tuyến hay chia đôi.
+// Không cần điều kiện Furie; khoảng kẹp co ít nhất một nửa sau mỗi 4 bước nên
+// số lần lặp không vượt quá 4*log2((b-a)/eps) + 4.
+KetQuaNewton newton_antoan(const DaThuc *p, double a, double b, const TuyChonNewton *tuychon);
+
+const char *newton_trangthai_ten(TrangThaiNewton trangthai);
+
+// ===== Giải theo lô (newton_batch.c) =====
+
+// Lô bài toán lưu dạng cấu trúc-của-mảng (SoA): hệ số x^k của bài toán j nằm ở
+// hs[k * soluong + j], nên mỗi làn SIMD đọc hệ số của các bài toán liền kề nhau.
+// Bài toán có bậc thấp hơn bacmax chỉ cần để các hệ số bậc cao bằng 0.
+typedef struct {
+    int soluong;           // Số bài toán
+    int bacmax;            // Bậc lớn nhất trong lô
+    double *hs;            // (bacmax + 1) * soluong hệ số
+    double *a, *b;         // Khoảng phân ly [a_j, b_j]
+    double *x0;            // Điểm bắt đầu
+    double *nghiem;        // Kết quả: nghiệm
+    int *solap;            // Kết quả: số lần lặp
+    unsigned char *trangthai; // Kết quả: TrangThaiNewton
+} LoNewton;
+
+// Đường tính toán cho newton_lo
+typedef enum {
+    NEWTON_SIMD_TUDONG = 0, // Chọn tập lệnh tốt nhất CPU hỗ trợ
+    NEWTON_SIMD_TAT,        // Vô hướng, từng bài toán một
+    NEWTON_SIMD_AVX2,       // 4 làn double
+    NEWTON_SIMD_AVX512      // 8 làn double
+} CheDoSIMD;
+
+int lonewton_tao(LoNewton *lo, int soluong, int bacmax);
+void lonewton_giaiphong(LoNewton *lo);
+
+// Chọn x0 là đầu mút có f*f'' > 0 (như Furie nhưng không quét khoảng), nếu không có thì lấy trung điểm
+void lonewton_chonx0(LoNewton *lo);
+
+// Giải toàn bộ lô, chia đều cho soluong_luong luồng (<= 0: theo số CPU).
+// Trả về chế độ SIMD thực sự đã dùng. Bỏ qua tuychon->theodoi.
+CheDoSIMD newton_lo(LoNewton *lo, const TuyChonNewton *tuychon, int soluong_luong, CheDoSIMD chedo);
+
+// Định dạng file lô (văn bản):
+//   dòng đầu: soluong bacmax
+//   mỗi dòng sau: a b hs[bacmax] ... hs[0]   (hệ số từ bậc cao xuống thấp như khi nhập tay)
+// Dòng trống hoặc bắt đầu bằng '#' được bỏ qua. Trả về 0 nếu đọc thành công.
+int lonewton_doc(FILE *vao, LoNewton *lo);
+// Ghi kết quả, mỗi dòng: chiso nghiem solap trangthai
+void lonewton_ghi(FILE *ra, const LoNewton *lo);
+
+const char *newton_simd_ten(CheDoSIMD chedo);
+
+// ===== Tìm mọi nghiệm thực bằng dãy Sturm (newton_sturm.c) =====
+
+// Bán kính Cauchy: mọi nghiệm (thực và phức) của p nằm trong |x| <= giá trị trả về
+double dathuc_bankinh_nghiem(const DaThuc *p);
+
+// Số nghiệm thực phân biệt của p trong (a,b] theo định lý Sturm; -1 nếu p là đa thức 0 hoặc a >= b
+int dathuc_songhiem(const DaThuc *p, double a, double b);
+
+// Tìm mọi nghiệm thực phân biệt của p trong (a,b] mà không cần khoảng phân ly:
+// dựng dãy Sturm, chia đôi để cô lập từng nghiệm, rồi tinh chỉnh các khoảng bằng
+// Newton có bảo vệ trên soluong_luong luồng (<= 0: tự chọn).
+// nghiem phải chứa được p->bac phần tử; kết quả sắp tăng dần.
+// Trả về số nghiệm tìm được, -1 nếu lỗi tham số hoặc hết bộ nhớ.
+int newton_tatca_nghiem(const DaThuc *p, double a, double b, double eps, double *nghiem, int soluong_luong);
+
+#endif
@@ -0,0 +1,349 @@
+#include "newton.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NEWTON_CO_X86 1
+#endif
+
+#define NGUONG_DAOHAM 1e-12 // Giống newton(): |f'| nhỏ hơn ngưỡng này thì dừng
+
+int lonewton_tao(LoNewton *lo, int soluong, int bacmax) {
+    memset(lo, 0, sizeof(*lo));
+    if (soluong < 0 || bacmax < 1) return -1;
+
+    size_t n = (size_t)soluong;
+    lo->soluong = soluong;
+    lo->bacmax = bacmax;
+    lo->hs = calloc(n * ((size_t)bacmax + 1), sizeof(double));
+    lo->a = calloc(n, sizeof(double));
+    lo->b = calloc(n, sizeof(double));
+    lo->x0 = calloc(n, sizeof(double));
+    lo->nghiem = calloc(n, sizeof(double));
+    lo->solap = calloc(n, sizeof(int));
+    lo->trangthai = calloc(n, sizeof(unsigned char));
+    if (n > 0 && !(lo->hs && lo->a && lo->b && lo->x0 && lo->nghiem && lo->solap && lo->trangthai)) {
+        lonewton_giaiphong(lo);
+        return -1;
+    }
+    return 0;
+}
+
+void lonewton_giaiphong(LoNewton *lo) {
+    free(lo->hs);
+    free(lo->a);
+    free(lo->b);
+    free(lo->x0);
+    free(lo->nghiem);
+    free(lo->solap);
+    free(lo->trangthai);
+    memset(lo, 0, sizeof(*lo));
+}
+
+// Tính f, f', f'' của bài toán j trực tiếp trên bố cục SoA
+static void danhgia_lo(const LoNewton *lo, int j, double x, double *fx, double *d1, double *d2) {
+    const size_t n = (size_t)lo->soluong;
+    double f = lo->hs[(size_t)lo->bacmax * n + j], df = 0, ddf = 0;
+    for (int k = lo->bacmax - 1; k >= 0; k--) {
+        ddf = ddf * x + df;
+        df = df * x + f;
+        f = f * x + lo->hs[(size_t)k * n + j];
+    }
+    *fx = f;
+    *d1 = df;
+    *d2 = 2 * ddf;
+}
+
+void lonewton_chonx0(LoNewton *lo) {
+    for (int j = 0; j < lo->soluong; j++) {
+        double fa, d1, d2a, fb, d2b;
+        danhgia_lo(lo, j, lo->a[j], &fa, &d1, &d2a);
+        danhgia_lo(lo, j, lo->b[j], &fb, &d1, &d2b);
+        if (fa * d2a > 0) lo->x0[j] = lo->a[j];
+        else if (fb * d2b > 0) lo->x0[j] = lo->b[j];
+        else lo->x0[j] = 0.5 * (lo->a[j] + lo->b[j]);
+    }
+}
+
+// Đường vô hướng: cùng điều kiện dừng với newton(), từng bài toán một
+static void giai_vohuong(LoNewton *lo, const TuyChonNewton *tc, int dau, int cuoi) {
+    for (int j = dau; j < cuoi; j++) {
+        double x = lo->x0[j], saiso = 1e9;
+        int lap = 0;
+        TrangThaiNewton trangthai = NEWTON_QUA_SOLAP;
+
+        while (saiso > tc->eps && lap < tc->maxlap) {
+            if (x < lo->a[j] || x > lo->b[j]) {
+                trangthai = NEWTON_RA_NGOAI;
+                break;
+            }
+            double fx, fdx, d2;
+            danhgia_lo(lo, j, x, &fx, &fdx, &d2);
+            if (fabs(fdx) < NGUONG_DAOHAM) {
+                trangthai = NEWTON_DAOHAM_0;
+                break;
+            }
+            double x_sau = x - fx / fdx;
+            saiso = fabs(x_sau - x);
+            x = x_sau;
+            lap++;
+        }
+
+        lo->nghiem[j] = x;
+        lo->solap[j] = lap;
+        lo->trangthai[j] = (unsigned char)(saiso <= tc->eps ? NEWTON_HOITU : trangthai);
+    }
+}
+
+#ifdef NEWTON_CO_X86
+// 4 bài toán mỗi lần; làn đã dừng bị che (mask) nhưng vẫn đi cùng vòng lặp cho tới khi cả khối dừng
+__attribute__((target("avx2,fma")))
+static void giai_avx2(LoNewton *lo, const TuyChonNewton *tc, int dau, int cuoi) {
+    const size_t n = (size_t)lo->soluong;
+    const __m256d eps = _mm256_set1_pd(tc->eps);
+    const __m256d nguong = _mm256_set1_pd(NGUONG_DAOHAM);
+    const __m256d motd = _mm256_set1_pd(1.0);
+    const __m256d trituyetdoi = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    int j = dau;
+
+    for (; j + 4 <= cuoi; j += 4) {
+        __m256d x = _mm256_loadu_pd(lo->x0 + j);
+        const __m256d a = _mm256_loadu_pd(lo->a + j);
+        const __m256d b = _mm256_loadu_pd(lo->b + j);
+        __m256d hoatdong = _mm256_cmp_pd(x, x, _CMP_EQ_OQ); // Bỏ làn có x0 = NaN
+        __m256d lap = _mm256_setzero_pd();
+        __m256d trangthai = _mm256_set1_pd(NEWTON_QUA_SOLAP);
+
+        for (int k = 0; k < tc->maxlap && _mm256_movemask_pd(hoatdong); k++) {
+            __m256d ngoai = _mm256_or_pd(_mm256_cmp_pd(x, a, _CMP_LT_OQ), _mm256_cmp_pd(x, b, _CMP_GT_OQ));
+            ngoai = _mm256_and_pd(ngoai, hoatdong);
+            trangthai = _mm256_blendv_pd(trangthai, _mm256_set1_pd(NEWTON_RA_NGOAI), ngoai);
+            hoatdong = _mm256_andnot_pd(ngoai, hoatdong);
+
+            __m256d f = _mm256_loadu_pd(lo->hs + (size_t)lo->bacmax * n + j);
+            __m256d df = _mm256_setzero_pd();
+            for (int i = lo->bacmax - 1; i >= 0; i--) {
+                df = _mm256_fmadd_pd(df, x, f);
+                f = _mm256_fmadd_pd(f, x, _mm256_loadu_pd(lo->hs + (size_t)i * n + j));
+            }
+
+            __m256d dao0 = _mm256_and_pd(_mm256_cmp_pd(_mm256_and_pd(df, trituyetdoi), nguong, _CMP_LT_OQ), hoatdong);
+            trangthai = _mm256_blendv_pd(trangthai, _mm256_set1_pd(NEWTON_DAOHAM_0), dao0);
+            hoatdong = _mm256_andnot_pd(dao0, hoatdong);
+
+            const __m256d x_sau = _mm256_sub_pd(x, _mm256_div_pd(f, df));
+            const __m256d buoc = _mm256_and_pd(_mm256_sub_pd(x_sau, x), trituyetdoi);
+            x = _mm256_blendv_pd(x, x_sau, hoatdong);
+            lap = _mm256_add_pd(lap, _mm256_and_pd(motd, hoatdong));
+
+            __m256d hoitu = _mm256_and_pd(_mm256_cmp_pd(buoc, eps, _CMP_LE_OQ), hoatdong);
+            trangthai = _mm256_blendv_pd(trangthai, _mm256_set1_pd(NEWTON_HOITU), hoitu);
+            hoatdong = _mm256_andnot_pd(hoitu, hoatdong);
+        }
+
+        double tt[4], sl[4];
+        _mm256_storeu_pd(lo->nghiem + j, x);
+        _mm256_storeu_pd(tt, trangthai);
+        _mm256_storeu_pd(sl, lap);
+        for (int l = 0; l < 4; l++) {
+            lo->trangthai[j + l] = (unsigned char)tt[l];
+            lo->solap[j + l] = (int)sl[l];
+        }
+    }
+
+    giai_vohuong(lo, tc, j, cuoi); // Phần dư không đủ 4 làn
+}
+
+// 8 bài toán mỗi lần với thanh ghi mặt nạ của AVX-512
+__attribute__((target("avx512f")))
+static void giai_avx512(LoNewton *lo, const TuyChonNewton *tc, int dau, int cuoi) {
+    const size_t n = (size_t)lo->soluong;
+    const __m512d eps = _mm512_set1_pd(tc->eps);
+    const __m512d nguong = _mm512_set1_pd(NGUONG_DAOHAM);
+    const __m512i motl = _mm512_set1_epi64(1);
+    int j = dau;
+
+    for (; j + 8 <= cuoi; j += 8) {
+        __m512d x = _mm512_loadu_pd(lo->x0 + j);
+        const __m512d a = _mm512_loadu_pd(lo->a + j);
+        const __m512d b = _mm512_loadu_pd(lo->b + j);
+        __mmask8 hoatdong = _mm512_cmp_pd_mask(x, x, _CMP_EQ_OQ);
+        __m512i lap = _mm512_setzero_si512();
+        __m512i trangthai = _mm512_set1_epi64(NEWTON_QUA_SOLAP);
+
+        for (int k = 0; k < tc->maxlap && hoatdong; k++) {
+            __mmask8 ngoai = _mm512_mask_cmp_pd_mask(hoatdong, x, a, _CMP_LT_OQ)
+                           | _mm512_mask_cmp_pd_mask(hoatdong, x, b, _CMP_GT_OQ);
+            trangthai = _mm512_mask_mov_epi64(trangthai, ngoai, _mm512_set1_epi64(NEWTON_RA_NGOAI));
+            hoatdong &= (__mmask8)~ngoai;
+
+            __m512d f = _mm512_loadu_pd(lo->hs + (size_t)lo->bacmax * n + j);
+            __m512d df = _mm512_setzero_pd();
+            for (int i = lo->bacmax - 1; i >= 0; i--) {
+                df = _mm512_fmadd_pd(df, x, f);
+                f = _mm512_fmadd_pd(f, x, _mm512_loadu_pd(lo->hs + (size_t)i * n + j));
+            }
+
+            __mmask8 dao0 = _mm512_mask_cmp_pd_mask(hoatdong, _mm512_abs_pd(df), nguong, _CMP_LT_OQ);
+            trangthai = _mm512_mask_mov_epi64(trangthai, dao0, _mm512_set1_epi64(NEWTON_DAOHAM_0));
+            hoatdong &= (__mmask8)~dao0;
+
+            const __m512d x_sau = _mm512_sub_pd(x, _mm512_maskz_div_pd(hoatdong, f, df));
+            const __m512d buoc = _mm512_abs_pd(_mm512_sub_pd(x_sau, x));
+            x = _mm512_mask_mov_pd(x, hoatdong, x_sau);
+            lap = _mm512_mask_add_epi64(lap, hoatdong, lap, motl);
+
+            __mmask8 hoitu = _mm512_mask_cmp_pd_mask(hoatdong, buoc, eps, _CMP_LE_OQ);
+            trangthai = _mm512_mask_mov_epi64(trangthai, hoitu, _mm512_set1_epi64(NEWTON_HOITU));
+            hoatdong &= (__mmask8)~hoitu;
+        }
+
+        long long tt[8], sl[8];
+        _mm512_storeu_pd(lo->nghiem + j, x);
+        _mm512_storeu_si512(tt, trangthai);
+        _mm512_storeu_si512(sl, lap);
+        for (int l = 0; l < 8; l++) {
+            lo->trangthai[j + l] = (unsigned char)tt[l];
+            lo->solap[j + l] = (int)sl[l];
+        }
+    }
+
+    giai_vohuong(lo, tc, j, cuoi);
+}
+#endif
+
+static CheDoSIMD chon_chedo(CheDoSIMD chedo) {
+#ifdef NEWTON_CO_X86
+    __builtin_cpu_init();
+    int co512 = __builtin_cpu_supports("avx512f");
+    int co2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (chedo == NEWTON_SIMD_TUDONG) return co512 ? NEWTON_SIMD_AVX512 : co2 ? NEWTON_SIMD_AVX2 : NEWTON_SIMD_TAT;
+    if (chedo == NEWTON_SIMD_AVX512 && !co512) chedo = NEWTON_SIMD_AVX2;
+    if (chedo == NEWTON_SIMD_AVX2 && !co2) chedo = NEWTON_SIMD_TAT;
+    return chedo;
+#else
+    (void)chedo;
+    return NEWTON_SIMD_TAT;
+#endif
+}
+
+typedef struct {
+    LoNewton *lo;
+    const TuyChonNewton *tuychon;
+    CheDoSIMD chedo;
+    int dau, cuoi;
+    int coluong; // 1 nếu đã chạy trên luồng riêng
+} PhanViec;
+
+static void *chay_phanviec(void *thamso) {
+    PhanViec *pv = thamso;
+    switch (pv->chedo) {
+#ifdef NEWTON_CO_X86
+        case NEWTON_SIMD_AVX512: giai_avx512(pv->lo, pv->tuychon, pv->dau, pv->cuoi); break;
+        case NEWTON_SIMD_AVX2: giai_avx2(pv->lo, pv->tuychon, pv->dau, pv->cuoi); break;
+#endif
+        default: giai_vohuong(pv->lo, pv->tuychon, pv->dau, pv->cuoi); break;
+    }
+    return NULL;
+}
+
+CheDoSIMD newton_lo(LoNewton *lo, const TuyChonNewton *tuychon, int soluong_luong, CheDoSIMD chedo) {
+    chedo = chon_chedo(chedo);
+    if (soluong_luong <= 0) {
+        long socpu = sysconf(_SC_NPROCESSORS_ONLN);
+        soluong_luong = socpu > 0 ? (int)socpu : 1;
+    }
+
+    // Mỗi luồng nhận một đoạn liên tiếp, căn theo bội của 8 để không cắt ngang khối SIMD
+    int moiluong = (lo->soluong + soluong_luong - 1) / soluong_luong;
+    moiluong = (moiluong + 7) / 8 * 8;
+    if (moiluong == 0) return chedo;
+    soluong_luong = (lo->soluong + moiluong - 1) / moiluong;
+
+    PhanViec *viec = malloc(sizeof(PhanViec) * (size_t)soluong_luong);
+    pthread_t *luong = malloc(sizeof(pthread_t) * (size_t)soluong_luong);
+    if (!viec || !luong) {
+        free(viec);
+        free(luong);
+        PhanViec toanbo = {lo, tuychon, chedo, 0, lo->soluong, 0};
+        chay_phanviec(&toanbo);
+        return chedo;
+    }
+
+    for (int t = 0; t < soluong_luong; t++) {
+        viec[t].lo = lo;
+        viec[t].tuychon = tuychon;
+        viec[t].chedo = chedo;
+        viec[t].dau = t * moiluong;
+        viec[t].cuoi = (t + 1) * moiluong < lo->soluong ? (t + 1) * moiluong : lo->soluong;
+        viec[t].coluong = 0;
+    }
+    // Luồng gọi tự làm phần đầu tiên; nếu không tạo được luồng thì cũng tự làm luôn phần đó
+    for (int t = 1; t < soluong_luong; t++)
+        viec[t].coluong = pthread_create(&luong[t], NULL, chay_phanviec, &viec[t]) == 0;
+    chay_phanviec(&viec[0]);
+    for (int t = 1; t < soluong_luong; t++) {
+        if (viec[t].coluong) pthread_join(luong[t], NULL);
+        else chay_phanviec(&viec[t]);
+    }
+
+    free(viec);
+    free(luong);
+    return chedo;
+}
+
+// Đọc số thực tiếp theo, bỏ qua các dòng chú thích bắt đầu bằng '#'
+static int doc_so(FILE *vao, double *so) {
+    int c;
+    while ((c = fgetc(vao)) != EOF) {
+        if (c == '#') {
+            while ((c = fgetc(vao)) != EOF && c != '\n') {}
+        } else if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            ungetc(c, vao);
+            return fscanf(vao, "%lf", so) == 1 ? 0 : -1;
+        }
+    }
+    return -1;
+}
+
+int lonewton_doc(FILE *vao, LoNewton *lo) {
+    double soluong, bacmax;
+    if (doc_so(vao, &soluong) != 0 || doc_so(vao, &bacmax) != 0) return -1;
+    if (lonewton_tao(lo, (int)soluong, (int)bacmax) != 0) return -1;
+
+    const size_t n = (size_t)lo->soluong;
+    for (int j = 0; j < lo->soluong; j++) {
+        int loi = doc_so(vao, &lo->a[j]) || doc_so(vao, &lo->b[j]);
+        for (int k = lo->bacmax; k >= 0 && !loi; k--) loi = doc_so(vao, &lo->hs[(size_t)k * n + j]);
+        if (loi) {
+            lonewton_giaiphong(lo);
+            return -1;
+        }
+        if (lo->a[j] > lo->b[j]) {
+            double tmp = lo->a[j]; lo->a[j] = lo->b[j]; lo->b[j] = tmp;
+        }
+    }
+    lonewton_chonx0(lo);
+    return 0;
+}
+
+void lonewton_ghi(FILE *ra, const LoNewton *lo) {
+    for (int j = 0; j < lo->soluong; j++)
+        fprintf(ra, "%d %.17g %d %s\n", j, lo->nghiem[j], lo->solap[j],
+                newton_trangthai_ten((TrangThaiNewton)lo->trangthai[j]));
+}
+
+const char *newton_simd_ten(CheDoSIMD chedo) {
+    switch (chedo) {
+        case NEWTON_SIMD_TUDONG: return "tu dong";
+        case NEWTON_SIMD_TAT: return "vo huong";
+        case NEWTON_SIMD_AVX2: return "avx2";
+        case NEWTON_SIMD_AVX512: return "avx512";
+    }
+    return "?";
+}
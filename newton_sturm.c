@@ -0,0 +1,264 @@
+#include "newton.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SAISO_TUONGDOI 1e-10 // Hệ số nhỏ hơn mức này (so với hệ số lớn nhất) coi như bằng 0
+#define SOKHOANG_MOILUONG 8  // Ít khoảng hơn thế này thì tạo luồng không đáng
+
+// Dãy Sturm p0 = p, p1 = p', p(k+1) = -phần dư(p(k-1) / p(k)), lưu liền trong một mảng
+typedef struct {
+    int sodathuc;
+    int *bac;         // Bậc của từng đa thức trong dãy
+    double **hs;      // hs[k] trỏ vào vung
+    double *vung;     // Một khối cấp phát cho cả dãy
+} DaySturm;
+
+// Chia mọi hệ số cho hệ số có trị tuyệt đối lớn nhất, rồi bỏ các hệ số bậc cao quá nhỏ
+static int chuanhoa(double *hs, int bac) {
+    double lonnhat = 0;
+    for (int i = 0; i <= bac; i++) lonnhat = fmax(lonnhat, fabs(hs[i]));
+    if (lonnhat == 0) return -1;
+    for (int i = 0; i <= bac; i++) hs[i] /= lonnhat;
+    while (bac >= 0 && fabs(hs[bac]) <= SAISO_TUONGDOI) bac--;
+    return bac;
+}
+
+static void sturm_giaiphong(DaySturm *day) {
+    free(day->bac);
+    free(day->hs);
+    free(day->vung);
+    memset(day, 0, sizeof(*day));
+}
+
+static int sturm_dung(const DaThuc *p, DaySturm *day) {
+    int n = p->bac;
+    memset(day, 0, sizeof(*day));
+    day->bac = malloc(sizeof(int) * (size_t)(n + 1));
+    day->hs = malloc(sizeof(double *) * (size_t)(n + 1));
+    day->vung = malloc(sizeof(double) * (size_t)(n + 1) * (size_t)(n + 2) / 2);
+    if (!day->bac || !day->hs || !day->vung) {
+        sturm_giaiphong(day);
+        return -1;
+    }
+
+    // Đa thức thứ k có bậc <= n - k nên chỉ cần n - k + 1 ô
+    double *o = day->vung;
+    for (int k = 0; k <= n; k++) {
+        day->hs[k] = o;
+        o += n - k + 1;
+    }
+
+    memcpy(day->hs[0], p->hs, sizeof(double) * (size_t)(n + 1));
+    day->bac[0] = chuanhoa(day->hs[0], n);
+    for (int i = 1; i <= n; i++) day->hs[1][i - 1] = i * p->hs[i];
+    day->bac[1] = chuanhoa(day->hs[1], n - 1);
+    day->sodathuc = day->bac[1] >= 0 ? 2 : 1;
+
+    while (day->sodathuc <= n && day->bac[day->sodathuc - 1] > 0) {
+        int k = day->sodathuc;
+        int bacchia = day->bac[k - 1];
+        const double *chia = day->hs[k - 1];
+
+        // Chia dài p(k-2) cho p(k-1), phần dư nằm lại trong du[0..bacchia-1]
+        double du[n + 1];
+        int bacdu = day->bac[k - 2];
+        memcpy(du, day->hs[k - 2], sizeof(double) * (size_t)(bacdu + 1));
+        for (int i = bacdu; i >= bacchia; i--) {
+            double thuong = du[i] / chia[bacchia];
+            for (int j = 0; j <= bacchia; j++) du[i - bacchia + j] -= thuong * chia[j];
+        }
+
+        // Phần dư nhỏ hơn sai số làm tròn (so với đa thức bị chia đã chuẩn hoá) coi là 0:
+        // khi đó p có nghiệm bội và p(k-1) là ước chung lớn nhất của p, p'
+        double lonnhat = 0;
+        for (int i = 0; i < bacchia; i++) lonnhat = fmax(lonnhat, fabs(du[i]));
+        if (lonnhat <= SAISO_TUONGDOI) break;
+
+        for (int i = 0; i < bacchia; i++) day->hs[k][i] = -du[i];
+        day->bac[k] = chuanhoa(day->hs[k], bacchia - 1);
+        day->sodathuc++;
+    }
+    return 0;
+}
+
+// Số lần đổi dấu của dãy Sturm tại x (bỏ qua các giá trị bằng 0)
+static int sturm_doidau(const DaySturm *day, double x) {
+    int doidau = 0, dautruoc = 0;
+    for (int k = 0; k < day->sodathuc; k++) {
+        const double *hs = day->hs[k];
+        double v = hs[day->bac[k]];
+        for (int i = day->bac[k] - 1; i >= 0; i--) v = v * x + hs[i];
+        int dau = (v > 0) - (v < 0);
+        if (dau != 0) {
+            if (dautruoc != 0 && dau != dautruoc) doidau++;
+            dautruoc = dau;
+        }
+    }
+    return doidau;
+}
+
+double dathuc_bankinh_nghiem(const DaThuc *p) {
+    double lonnhat = 0;
+    for (int i = 0; i < p->bac; i++) lonnhat = fmax(lonnhat, fabs(p->hs[i] / p->hs[p->bac]));
+    return 1 + lonnhat;
+}
+
+int dathuc_songhiem(const DaThuc *p, double a, double b) {
+    if (!p || !p->hs || p->bac < 0 || !(a < b)) return -1;
+
+    int bac = p->bac;
+    while (bac >= 0 && p->hs[bac] == 0) bac--;
+    if (bac < 0) return -1;
+    if (bac == 0) return 0;
+
+    DaThuc g = {bac, p->hs};
+    DaySturm day;
+    if (sturm_dung(&g, &day) != 0) return -1;
+    int songhiem = sturm_doidau(&day, a) - sturm_doidau(&day, b);
+    sturm_giaiphong(&day);
+    return songhiem;
+}
+
+typedef struct {
+    double dau, cuoi;
+} KhoangNghiem;
+
+// Tinh chỉnh nghiệm duy nhất trong (lo, hi]: Newton nhưng luôn giữ khoảng chứa nghiệm,
+// bước nào nhảy ra ngoài thì thay bằng chia đôi
+static double tinhchinh(const DaThuc *p, const DaySturm *day, double lo, double hi, double eps) {
+    double flo, fhi, d1;
+    dathuc_danhgia(p, lo, &flo, NULL, NULL);
+    dathuc_danhgia(p, hi, &fhi, NULL, NULL);
+    if (fhi == 0) return hi;
+
+    if (flo * fhi < 0) {
+        double x = 0.5 * (lo + hi);
+        for (int lap = 0; lap < 200 && hi - lo > eps; lap++) {
+            double fx;
+            dathuc_danhgia(p, x, &fx, &d1, NULL);
+            if (fx == 0) return x;
+            if ((fx < 0) == (flo < 0)) { lo = x; flo = fx; } else hi = x;
+
+            double x_sau = x - fx / d1;
+            if (!(x_sau > lo && x_sau < hi)) x_sau = 0.5 * (lo + hi); // Cũng bắt trường hợp d1 = 0
+            if (fabs(x_sau - x) <= eps) return x_sau;
+            x = x_sau;
+        }
+        return 0.5 * (lo + hi);
+    }
+
+    // Nghiệm bội chẵn: f không đổi dấu, chia đôi theo số nghiệm đếm bằng dãy Sturm
+    int vlo = sturm_doidau(day, lo);
+    while (hi - lo > eps) {
+        double giua = 0.5 * (lo + hi);
+        if (giua <= lo || giua >= hi) break;
+        if (vlo - sturm_doidau(day, giua) >= 1) hi = giua;
+        else { lo = giua; vlo = sturm_doidau(day, lo); }
+    }
+    return 0.5 * (lo + hi);
+}
+
+typedef struct {
+    const DaThuc *p;
+    const DaySturm *day;
+    const KhoangNghiem *khoang;
+    double *nghiem;
+    double eps;
+    int dau, cuoi;
+} PhanTinhChinh;
+
+static void *chay_tinhchinh(void *thamso) {
+    PhanTinhChinh *pv = thamso;
+    for (int i = pv->dau; i < pv->cuoi; i++)
+        pv->nghiem[i] = tinhchinh(pv->p, pv->day, pv->khoang[i].dau, pv->khoang[i].cuoi, pv->eps);
+    return NULL;
+}
+
+int newton_tatca_nghiem(const DaThuc *p, double a, double b, double eps, double *nghiem, int soluong_luong) {
+    if (!p || !p->hs || p->bac < 1 || p->hs[p->bac] == 0 || !(a < b) || eps <= 0 || !nghiem) return -1;
+
+    DaySturm day;
+    if (sturm_dung(p, &day) != 0) return -1;
+
+    // B1: cô lập nghiệm bằng chia đôi, dùng ngăn xếp thay cho đệ quy
+    typedef struct { double lo, hi; int vlo, vhi; } MucNganXep;
+    int n = p->bac, sokhoang = 0, dinh = 0, succhua = 64;
+    KhoangNghiem *khoang = malloc(sizeof(KhoangNghiem) * (size_t)n);
+    MucNganXep *nganxep = malloc(sizeof(MucNganXep) * (size_t)succhua);
+    if (!khoang || !nganxep) {
+        free(khoang);
+        free(nganxep);
+        sturm_giaiphong(&day);
+        return -1;
+    }
+
+    nganxep[dinh].lo = a;
+    nganxep[dinh].hi = b;
+    nganxep[dinh].vlo = sturm_doidau(&day, a);
+    nganxep[dinh].vhi = sturm_doidau(&day, b);
+    dinh++;
+    while (dinh > 0) {
+        dinh--;
+        double lo = nganxep[dinh].lo, hi = nganxep[dinh].hi;
+        int vlo = nganxep[dinh].vlo, vhi = nganxep[dinh].vhi;
+        int songhiem = vlo - vhi;
+        if (songhiem <= 0) continue;
+
+        double giua = 0.5 * (lo + hi);
+        if (songhiem == 1 || hi - lo <= eps || giua <= lo || giua >= hi) {
+            // Một nghiệm, hoặc cụm nghiệm sát nhau hơn eps thì coi là một
+            if (sokhoang < n) {
+                khoang[sokhoang].dau = lo;
+                khoang[sokhoang].cuoi = hi;
+                sokhoang++;
+            }
+            continue;
+        }
+
+        if (dinh + 2 > succhua) {
+            MucNganXep *moi = realloc(nganxep, sizeof(MucNganXep) * (size_t)succhua * 2);
+            if (!moi) break;
+            nganxep = moi;
+            succhua *= 2;
+        }
+
+        // Nửa trái đẩy sau để được xử lý trước, giữ các khoảng theo thứ tự tăng dần
+        int vgiua = sturm_doidau(&day, giua);
+        nganxep[dinh].lo = giua; nganxep[dinh].hi = hi; nganxep[dinh].vlo = vgiua; nganxep[dinh].vhi = vhi;
+        dinh++;
+        nganxep[dinh].lo = lo; nganxep[dinh].hi = giua; nganxep[dinh].vlo = vlo; nganxep[dinh].vhi = vgiua;
+        dinh++;
+    }
+    free(nganxep);
+
+    // B2: tinh chỉnh song song, mỗi luồng một đoạn liên tiếp các khoảng
+    if (soluong_luong <= 0) {
+        long socpu = sysconf(_SC_NPROCESSORS_ONLN);
+        soluong_luong = socpu > 0 ? (int)socpu : 1;
+    }
+    int toida = (sokhoang + SOKHOANG_MOILUONG - 1) / SOKHOANG_MOILUONG;
+    if (soluong_luong > toida) soluong_luong = toida > 0 ? toida : 1;
+
+    PhanTinhChinh viec[soluong_luong];
+    pthread_t luong[soluong_luong];
+    int coluong[soluong_luong];
+    int moiluong = (sokhoang + soluong_luong - 1) / soluong_luong;
+    for (int t = 0; t < soluong_luong; t++) {
+        viec[t] = (PhanTinhChinh){p, &day, khoang, nghiem, eps, t * moiluong,
+                                  (t + 1) * moiluong < sokhoang ? (t + 1) * moiluong : sokhoang};
+        coluong[t] = t > 0 && pthread_create(&luong[t], NULL, chay_tinhchinh, &viec[t]) == 0;
+    }
+    chay_tinhchinh(&viec[0]);
+    for (int t = 1; t < soluong_luong; t++) {
+        if (coluong[t]) pthread_join(luong[t], NULL);
+        else chay_tinhchinh(&viec[t]);
+    }
+
+    free(khoang);
+    sturm_giaiphong(&day);
+    return sokhoang;
+}
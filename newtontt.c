@@ -1,217 +1,315 @@
-#include <stdio.h>
-#include <math.h>
-#include <string.h>
-
-#define Bacmax 10 // Bậc đa thức tối đa
-
-// Nguyên mẫu hàm
-void nhapheso(int *bac); // Hàm nhập hệ số
-void indathuc(const char *tenham, int bac, int capdaoham); // Hàm in đa thức f, f', f''
-double f(double x, int bac); // Hàm f(x)
-double daoham_f(double x, int bac); // Đạo hàm f'(x)
-double daoham2_f(double x, int bac); // Đạo hàm f''(x)
-double newton(double a, double b, double x0, double eps, int maxlap, int bac); // Thuật toán Newton
-int furie(int bac, double a, double b); // Hàm kiểm tra điều kiện hội tụ Furie
-
-// Mảng lưu hệ số toàn cục
-float hs[Bacmax];
-
-int main() {
-    memset(hs, 0, sizeof(hs)); // Gán toàn bộ hệ số = 0
-
-    int bac;
-    nhapheso(&bac); // Nhập hệ số và bậc đa thức
-
-    printf("\n============================================\n");
-    indathuc("f(x)", bac, 0);   // In f(x)
-    indathuc("f'(x)", bac, 1);  // In f'(x)
-    indathuc("f''(x)", bac, 2); // In f''(x)
-    printf("============================================\n\n");
-
-    // Nhập khoảng phân ly nghiệm
-    double a, b;
-    printf(">> Nhap khoang phan ly nghiem [a,b]: ");
-    scanf("%lf %lf", &a, &b);
-
-    // Đảo lại nếu người dùng nhập ngược a > b
-    if (a > b) {
-        double tmp = a; a = b; b = tmp;
-        printf(">> Canh bao: a > b, tu dong hoan doi lai thanh [%.3lf, %.3lf]\n", a, b);
-    }
-
-    // Nhập sai số epsilon
-    double eps;
-    printf(">> Nhap sai so cho phep epsilon: ");
-    scanf("%lf", &eps);
-
-    if (eps <= 0) {
-        eps = 1e-6;
-        printf(">> Canh bao: Sai so khong hop le, tu dong dat epsilon = 1e-6\n");
-    }
-
-    // Kiểm tra điều kiện hội tụ Furie
-    int kiemTra = furie(bac, a, b);
-    double x0;
-    if (kiemTra == 1)
-        x0 = a; // Nếu f(a)*f''(a)>0 → chọn a làm điểm bắt đầu
-    else if (kiemTra == -1)
-        x0 = b; // Nếu f(b)*f''(b)>0 → chọn b làm điểm bắt đầu
-    else if (kiemTra == -2) {
-        printf(">> Dieu kien hoi tu Furie khong duoc dam bao.\n");
-        return 0;
-    }
-
-    printf(">> Bat dau Newton voi x0 = %.6lf\n", x0);
-
-    // Gọi hàm Newton tìm nghiệm gần đúng
-    newton(a, b, x0, eps, 100, bac);
-    return 0;
-}
-
-// Hàm nhập hệ số đa thức
-void nhapheso(int *bac) {
-    printf(">> Nhap bac da thuc (<=%d): ", Bacmax);
-    scanf("%d", bac);
-    for (int i = *bac; i >= 0; i--) {
-        printf("   He so cua x^%d: ", i);
-        scanf("%f", &hs[i]);
-    }
-}
-
-// Hàm in đa thức f(x), f'(x), f''(x)
-void indathuc(const char *tenham, int bac, int capdaoham) {
-    printf("%s = ", tenham);
-    int daIn = 0;
-    for (int i = bac; i >= capdaoham; i--) {
-        double hsTam = hs[i];
-        for (int j = 0; j < capdaoham; j++) hsTam *= (i - j); // Nhân thêm theo đạo hàm
-        if (fabs(hsTam) < 1e-12) continue; // Bỏ qua hệ số ~0
-
-        // In dấu cộng/trừ hợp lý tránh hiện dấu ở đầu
-        if (daIn) printf(hsTam > 0 ? " + " : " - "); else if (hsTam < 0) printf("-");
-
-        // Bỏ .000 nếu là số nguyên
-        if (fabs(hsTam) != 1 || (i - capdaoham) == 0) {
-            if (fabs(hsTam - (int)hsTam) < 1e-6)
-                printf("%d", (int)fabs(hsTam));
-            else
-                printf("%.3f", fabs(hsTam));
-        }
-
-        // In phần x, x^2, x^3...
-        if (i - capdaoham > 0) {
-            printf("x");
-            if (i - capdaoham > 1) printf("^%d", i - capdaoham);
-        }
-        daIn = 1;
-    }
-    if (!daIn) printf("0");
-    printf("\n");
-}
-
-// Hàm tính f(x)
-double f(double x, int bac) {
-    double kq = 0;
-    for (int i = bac; i >= 0; i--) kq += hs[i] * pow(x, i);
-    return kq;
-}
-
-// Hàm tính đạo hàm cấp 1 f'(x)
-double daoham_f(double x, int bac) {
-    double kq = 0;
-    for (int i = 1; i <= bac; i++) kq += i * hs[i] * pow(x, i - 1);
-    return kq;
-}
-
-// Hàm tính đạo hàm cấp 2 f''(x)
-double daoham2_f(double x, int bac) {
-    double kq = 0;
-    for (int i = 2; i <= bac; i++) kq += i * (i - 1) * hs[i] * pow(x, i - 2);
-    return kq;
-}
-
-// Thuật toán Newton tìm nghiệm gần đúng
-double newton(double a, double b, double x0, double eps, int maxlap, int bac) {
-    // Xử lý riêng cho bậc nhất: chỉ lặp 1 lần
-    if (bac == 1) {
-        double fx = f(x0, bac);
-        double fdx = daoham_f(x0, bac);
-    if (fabs(fdx) < 1e-12) {
-        printf(">> Dao ham f'(x) = 0. Khong the ap dung Newton.\n");
-        return x0;
-    }
-
-    double x1 = x0 - fx / fdx;
-    double saiso = fabs(f(x1, bac)); // Sửa ở đây: sai số = |f(x1)|
-
-    printf("|---------|---------------|--------|\n");
-    printf("| LAN LAP | GIA TRI CUA x | SAI SO |\n");
-    printf("|---------|---------------|--------|\n");
-    printf("|%-9d|%-15lf|%-8lf|\n", 1, x1, saiso);
-    printf("|---------|---------------|--------|\n");
-    printf(">> Nghiem gan dung: %f\n", x1);
-    printf(">> So lan lap: 1\n");
-    printf(">> Sai so: %lf\n", saiso);
-    return x1;
-}
-
-
-    double x = x0, saiso = 1e9; // Sai số khởi tạo lớn để bắt đầu vòng lặp
-    int lap = 0;
-
-    printf("|---------|---------------|--------|\n");
-    printf("| LAN LAP | GIA TRI CUA x | SAI SO |\n");
-    printf("|---------|---------------|--------|\n");
-
-    while (saiso > eps && lap < maxlap && x >= a && x <= b) {
-        double fx = f(x, bac), fdx = daoham_f(x, bac);
-
-        if (fabs(fdx) < 1e-12) { // Nếu đạo hàm gần 0, dừng để tránh chia 0
-            printf(">> Dao ham f'(x) = 0 tai x = %.6lf. Dung lai.\n", x);
-            break;
-        }
-
-        double x_sau = x - fx / fdx; // Công thức Newton-Raphson
-        saiso = fabs(x_sau - x); // Cập nhật sai số
-        x = x_sau; // Gán lại x cho vòng lặp sau
-        lap++;
-
-        printf("|%-9d|%-15lf|%-8lf|\n", lap, x, saiso);
-    }
-
-    printf("|---------|---------------|--------|\n");
-
-    // Thông báo kết quả
-    if (saiso > eps)
-        printf(">> Khong tim thay nghiem trong khoang [%.3lf, %.3lf]\n", a, b);
-    else {
-        printf(">> Nghiem gan dung: %f\n", x);
-        printf(">> So lan lap: %d\n", lap);
-        printf(">> Sai so: %lf\n", saiso);
-    }
-
-    return x;
-}
-
-// Hàm kiểm tra điều kiện hội tụ Furie 
-int furie(int bac, double a, double b) {
-    if (bac == 1) {
-        // Bậc nhất luôn hội tụ vì là hàm tuyến tính
-        printf(">> Da thuc bac nhat, luon hoi tu voi 1 nghiem duy nhat.\n");
-        return 1; // Chọn a làm điểm bắt đầu
-    }
-
-    int dauDaoHam1 = daoham_f(a, bac) >= 0; // Dấu của f'(x) tại a
-    for (double i = a; i <= b; i += 0.01)
-        if ((daoham_f(i, bac) >= 0) != dauDaoHam1) return -2; // f' đổi dấu → không hội tụ
-
-    int dauDaoHam2 = daoham2_f(a, bac) >= 0; // Dấu của f''(x) tại a
-    for (double i = a; i <= b; i += 0.01)
-        if ((daoham2_f(i, bac) >= 0) != dauDaoHam2) return -2; // f'' đổi dấu → không hội tụ
-
-    // Chọn hướng hội tụ theo dấu f * f''
-    if (f(a, bac) * daoham2_f(a, bac) > 0) return 1;
-    if (f(b, bac) * daoham2_f(b, bac) > 0) return -1;
-
-    return 0;
-}
\ No newline at end of file
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#include "newton.h"
+
+// Nguyên mẫu hàm
+int nhapheso(DaThuc *p); // Hàm nhập bậc và hệ số
+void indathuc(const char *tenham, const DaThuc *p, int capdaoham); // Hàm in đa thức f, f', f''
+void inbuoclap(void *ngucanh, int lap, double x, double saiso); // In một dòng của bảng lặp
+double f(const DaThuc *p, double x); // Hàm f(x) tính bằng pow (cách cũ)
+double daoham_f(const DaThuc *p, double x); // Đạo hàm f'(x) tính bằng pow (cách cũ)
+double daoham2_f(const DaThuc *p, double x); // Đạo hàm f''(x) tính bằng pow (cách cũ)
+void dokiemtra_tocdo(void); // Đo tốc độ đánh giá đa thức (--bench)
+int giai_filelo(const char *tenvao, const char *tenra, int soluong_luong); // Giải lô từ file (--batch)
+void dokiemtra_lo(int soluong); // Đo thông lượng giải lô (--bench-batch)
+void intatca_nghiem(const DaThuc *p, double a, double b, double eps); // Tìm và in mọi nghiệm thực trong (a,b]
+
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        dokiemtra_tocdo();
+        return 0;
+    }
+    if (argc > 3 && strcmp(argv[1], "--batch") == 0)
+        return giai_filelo(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : 0);
+    if (argc > 1 && strcmp(argv[1], "--bench-batch") == 0) {
+        dokiemtra_lo(argc > 2 ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+
+    // Chế độ tự động: không nhập khoảng, tìm mọi nghiệm thực trong bán kính Cauchy
+    int tudong = argc > 1 && strcmp(argv[1], "--tudong") == 0;
+
+    DaThuc p;
+    if (nhapheso(&p) != 0) { // Nhập hệ số và bậc đa thức
+        printf(">> Bac da thuc khong hop le.\n");
+        return 0;
+    }
+
+    printf("\n============================================\n");
+    indathuc("f(x)", &p, 0);   // In f(x)
+    indathuc("f'(x)", &p, 1);  // In f'(x)
+    indathuc("f''(x)", &p, 2); // In f''(x)
+    printf("============================================\n\n");
+
+    if (tudong) {
+        double r = dathuc_bankinh_nghiem(&p);
+        intatca_nghiem(&p, -r, r, 1e-12);
+        dathuc_giaiphong(&p);
+        return 0;
+    }
+
+    // Nhập khoảng phân ly nghiệm
+    double a, b;
+    printf(">> Nhap khoang phan ly nghiem [a,b]: ");
+    scanf("%lf %lf", &a, &b);
+
+    // Đảo lại nếu người dùng nhập ngược a > b
+    if (a > b) {
+        double tmp = a; a = b; b = tmp;
+        printf(">> Canh bao: a > b, tu dong hoan doi lai thanh [%.3lf, %.3lf]\n", a, b);
+    }
+
+    // Nhập sai số epsilon
+    double eps;
+    printf(">> Nhap sai so cho phep epsilon: ");
+    scanf("%lf", &eps);
+
+    if (eps <= 0) {
+        eps = 1e-6;
+        printf(">> Canh bao: Sai so khong hop le, tu dong dat epsilon = 1e-6\n");
+    }
+
+    // Kiểm tra điều kiện hội tụ Furie
+    if (p.bac == 1)
+        printf(">> Da thuc bac nhat, luon hoi tu voi 1 nghiem duy nhat.\n");
+    int kiemTra = furie(&p, a, b);
+    double x0;
+    if (kiemTra == 1)
+        x0 = a; // Nếu f(a)*f''(a)>0 → chọn a làm điểm bắt đầu
+    else if (kiemTra == -1)
+        x0 = b; // Nếu f(b)*f''(b)>0 → chọn b làm điểm bắt đầu
+    else {
+        printf(">> Dieu kien hoi tu Furie khong duoc dam bao.\n");
+        printf(">> Chuyen sang tim moi nghiem trong khoang bang day Sturm.\n");
+        intatca_nghiem(&p, a, b, eps);
+        dathuc_giaiphong(&p);
+        return 0;
+    }
+
+    printf(">> Bat dau Newton voi x0 = %.6lf\n", x0);
+
+    // Gọi hàm Newton tìm nghiệm gần đúng, bảng lặp được in qua inbuoclap
+    TuyChonNewton tuychon = {eps, 100, inbuoclap, NULL};
+    printf("|---------|---------------|--------|\n");
+    printf("| LAN LAP | GIA TRI CUA x | SAI SO |\n");
+    printf("|---------|---------------|--------|\n");
+    KetQuaNewton kq = newton(&p, a, b, x0, &tuychon);
+    printf("|---------|---------------|--------|\n");
+
+    // Thông báo kết quả
+    if (kq.trangthai == NEWTON_DAOHAM_0)
+        printf(">> Dao ham f'(x) = 0 tai x = %.6lf. Dung lai.\n", kq.nghiem);
+    if (kq.trangthai != NEWTON_HOITU)
+        printf(">> Khong tim thay nghiem trong khoang [%.3lf, %.3lf]\n", a, b);
+    else {
+        printf(">> Nghiem gan dung: %f\n", kq.nghiem);
+        printf(">> So lan lap: %d\n", kq.solap);
+        printf(">> Sai so: %lf\n", kq.saiso);
+    }
+
+    dathuc_giaiphong(&p);
+    return 0;
+}
+
+// Hàm nhập bậc và hệ số đa thức
+int nhapheso(DaThuc *p) {
+    int bac;
+    printf(">> Nhap bac da thuc: ");
+    if (scanf("%d", &bac) != 1 || bac < 1 || dathuc_tao(p, bac) != 0)
+        return -1;
+    for (int i = bac; i >= 0; i--) {
+        printf("   He so cua x^%d: ", i);
+        scanf("%lf", &p->hs[i]);
+    }
+    return 0;
+}
+
+// Hàm in đa thức f(x), f'(x), f''(x)
+void indathuc(const char *tenham, const DaThuc *p, int capdaoham) {
+    printf("%s = ", tenham);
+    int daIn = 0;
+    for (int i = p->bac; i >= capdaoham; i--) {
+        double hsTam = p->hs[i];
+        for (int j = 0; j < capdaoham; j++) hsTam *= (i - j); // Nhân thêm theo đạo hàm
+        if (fabs(hsTam) < 1e-12) continue; // Bỏ qua hệ số ~0
+
+        // In dấu cộng/trừ hợp lý tránh hiện dấu ở đầu
+        if (daIn) printf(hsTam > 0 ? " + " : " - "); else if (hsTam < 0) printf("-");
+
+        // Bỏ .000 nếu là số nguyên
+        if (fabs(hsTam) != 1 || (i - capdaoham) == 0) {
+            if (fabs(hsTam - (int)hsTam) < 1e-6)
+                printf("%d", (int)fabs(hsTam));
+            else
+                printf("%.3f", fabs(hsTam));
+        }
+
+        // In phần x, x^2, x^3...
+        if (i - capdaoham > 0) {
+            printf("x");
+            if (i - capdaoham > 1) printf("^%d", i - capdaoham);
+        }
+        daIn = 1;
+    }
+    if (!daIn) printf("0");
+    printf("\n");
+}
+
+// Tìm và in mọi nghiệm thực trong (a,b]
+void intatca_nghiem(const DaThuc *p, double a, double b, double eps) {
+    double nghiem[p->bac];
+    int songhiem = newton_tatca_nghiem(p, a, b, eps, nghiem, 0);
+    if (songhiem < 0) {
+        printf(">> Khong the tim nghiem (tham so khong hop le).\n");
+        return;
+    }
+    printf(">> Tim thay %d nghiem thuc phan biet trong (%.3lf, %.3lf]\n", songhiem, a, b);
+    for (int i = 0; i < songhiem; i++) {
+        double fx;
+        dathuc_danhgia(p, nghiem[i], &fx, NULL, NULL);
+        printf("   x%d = %.12lf   |f(x)| = %.3e\n", i + 1, nghiem[i], fabs(fx));
+    }
+}
+
+// In một dòng của bảng lặp Newton
+void inbuoclap(void *ngucanh, int lap, double x, double saiso) {
+    (void)ngucanh;
+    printf("|%-9d|%-15lf|%-8lf|\n", lap, x, saiso);
+}
+
+// Hàm tính f(x)
+double f(const DaThuc *p, double x) {
+    double kq = 0;
+    for (int i = p->bac; i >= 0; i--) kq += p->hs[i] * pow(x, i);
+    return kq;
+}
+
+// Hàm tính đạo hàm cấp 1 f'(x)
+double daoham_f(const DaThuc *p, double x) {
+    double kq = 0;
+    for (int i = 1; i <= p->bac; i++) kq += i * p->hs[i] * pow(x, i - 1);
+    return kq;
+}
+
+// Hàm tính đạo hàm cấp 2 f''(x)
+double daoham2_f(const DaThuc *p, double x) {
+    double kq = 0;
+    for (int i = 2; i <= p->bac; i++) kq += i * (i - 1) * p->hs[i] * pow(x, i - 2);
+    return kq;
+}
+
+// Đo số lần đánh giá (f, f', f'') mỗi giây: cách cũ dùng pow so với Horner gộp
+void dokiemtra_tocdo(void) {
+    const int solan = 2000000;
+    int cacbac[] = {3, 6, 9};
+
+    printf("| BAC | CACH CU (lan/s) | HORNER GOP (lan/s) | TANG TOC |\n");
+    for (int k = 0; k < (int)(sizeof(cacbac) / sizeof(cacbac[0])); k++) {
+        DaThuc p;
+        int bac = cacbac[k];
+        if (dathuc_tao(&p, bac) != 0) return;
+        for (int i = 0; i <= bac; i++) p.hs[i] = ((i % 3) - 1) + 0.5 * i;
+
+        volatile double tong = 0; // Tránh trình biên dịch bỏ vòng lặp
+        clock_t batdau = clock();
+        for (int n = 0; n < solan; n++) {
+            double x = 0.5 + n * 1e-7;
+            tong += f(&p, x) + daoham_f(&p, x) + daoham2_f(&p, x);
+        }
+        double tgcu = (double)(clock() - batdau) / CLOCKS_PER_SEC;
+
+        batdau = clock();
+        for (int n = 0; n < solan; n++) {
+            double x = 0.5 + n * 1e-7, fx, d1, d2;
+            dathuc_danhgia(&p, x, &fx, &d1, &d2);
+            tong += fx + d1 + d2;
+        }
+        double tgmoi = (double)(clock() - batdau) / CLOCKS_PER_SEC;
+
+        printf("| %3d | %15.0f | %18.0f | %7.1fx |\n", bac,
+               solan / tgcu, solan / tgmoi, tgcu / tgmoi);
+        dathuc_giaiphong(&p);
+    }
+}
+
+// Giải toàn bộ các bài toán trong file lô và ghi kết quả ra file
+int giai_filelo(const char *tenvao, const char *tenra, int soluong_luong) {
+    FILE *vao = fopen(tenvao, "r");
+    if (!vao) {
+        printf(">> Khong mo duoc file %s\n", tenvao);
+        return 1;
+    }
+    LoNewton lo;
+    int loi = lonewton_doc(vao, &lo);
+    fclose(vao);
+    if (loi) {
+        printf(">> File lo %s sai dinh dang\n", tenvao);
+        return 1;
+    }
+
+    FILE *ra = fopen(tenra, "w");
+    if (!ra) {
+        printf(">> Khong ghi duoc file %s\n", tenra);
+        lonewton_giaiphong(&lo);
+        return 1;
+    }
+    TuyChonNewton tuychon = {1e-12, 100, NULL, NULL};
+    CheDoSIMD chedo = newton_lo(&lo, &tuychon, soluong_luong, NEWTON_SIMD_TUDONG);
+    lonewton_ghi(ra, &lo);
+    fclose(ra);
+
+    printf(">> Da giai %d bai toan (%s), ket qua ghi vao %s\n", lo.soluong, newton_simd_ten(chedo), tenra);
+    lonewton_giaiphong(&lo);
+    return 0;
+}
+
+static double dongho_giay(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Thông lượng (nghiệm/giây) của đường vô hướng so với AVX2/AVX-512 và nhiều luồng
+// trên các đường cong hiệu chuẩn bậc 3 ngẫu nhiên (x - r)(x^2 + px + q), có đúng một nghiệm trong [0,1]
+void dokiemtra_lo(int soluong) {
+    LoNewton lo;
+    if (soluong <= 0 || lonewton_tao(&lo, soluong, 3) != 0) return;
+
+    srand(12345);
+    const size_t n = (size_t)soluong;
+    for (int j = 0; j < soluong; j++) {
+        double r = 0.1 + 0.8 * rand() / RAND_MAX;
+        double p = -1 + 2.0 * rand() / RAND_MAX;
+        double q = p * p / 4 + 0.1 + (double)rand() / RAND_MAX;
+        lo.hs[3 * n + j] = 1;
+        lo.hs[2 * n + j] = p - r;
+        lo.hs[1 * n + j] = q - r * p;
+        lo.hs[0 * n + j] = -r * q;
+        lo.a[j] = 0;
+        lo.b[j] = 1;
+    }
+    lonewton_chonx0(&lo);
+
+    TuyChonNewton tuychon = {1e-12, 100, NULL, NULL};
+    struct { CheDoSIMD chedo; int luong; } cauhinh[] = {
+        {NEWTON_SIMD_TAT, 1}, {NEWTON_SIMD_AVX2, 1}, {NEWTON_SIMD_AVX512, 1},
+        {NEWTON_SIMD_TAT, 0}, {NEWTON_SIMD_TUDONG, 0},
+    };
+
+    printf("| DUONG TINH | LUONG | NGHIEM/GIAY | HOI TU |\n");
+    for (int c = 0; c < (int)(sizeof(cauhinh) / sizeof(cauhinh[0])); c++) {
+        double batdau = dongho_giay();
+        CheDoSIMD dung = newton_lo(&lo, &tuychon, cauhinh[c].luong, cauhinh[c].chedo);
+        double tg = dongho_giay() - batdau;
+
+        int hoitu = 0;
+        for (int j = 0; j < soluong; j++) hoitu += lo.trangthai[j] == NEWTON_HOITU;
+        printf("| %-10s | %5s | %11.0f | %5.1f%% |\n", newton_simd_ten(dung),
+               cauhinh[c].luong ? "1" : "tat ca", soluong / tg, 100.0 * hoitu / soluong);
+    }
+    lonewton_giaiphong(&lo);
+}